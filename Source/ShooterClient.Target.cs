@@ -10,6 +10,8 @@ public class ShooterClientTarget : TargetRules
 		Type = TargetType.Client;
 		bUsesSteam = true;		
 
+        bWithPushModel = true;
+
         ExtraModuleNames.Add("ShooterGame");
     }
 }
@@ -10,6 +10,8 @@ public class ShooterGameTarget : TargetRules
         Type = TargetType.Game;
         bUsesSteam = true;
 
+		bWithPushModel = true;
+
 		ExtraModuleNames.Add("ShooterGame");
     }
 }
@@ -9,6 +9,8 @@
 #include "Bots/ShooterAIController.h"
 #include "Online/ShooterPlayerState.h"
 
+DECLARE_CYCLE_STAT(TEXT("Bot Has LoS To"), STAT_ShooterBotHasLoSTo, STATGROUP_ShooterGame);
+
 UBTDecorator_HasLoSTo::UBTDecorator_HasLoSTo(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -60,6 +62,8 @@ bool UBTDecorator_HasLoSTo::CalculateRawConditionValue(class UBehaviorTreeCompon
 
 bool UBTDecorator_HasLoSTo::CalculateRawConditionValue(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterBotHasLoSTo, ShooterBots, HasLoSTo);
+
 	const UBlackboardComponent* MyBlackboard = OwnerComp.GetBlackboardComponent();
 	AAIController* MyController = OwnerComp.GetAIOwner();
 	bool HasLOS = false;
@@ -0,0 +1,57 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Bots/BTTask_FindMoveGoal.h"
+#include "Bots/ShooterAIController.h"
+#include "Bots/ShooterBotPathQueue.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyAllTypes.h"
+
+UBTTask_FindMoveGoal::UBTTask_FindMoveGoal(const FObjectInitializer& ObjectInitializer) 
+	: Super(ObjectInitializer)
+{
+}
+
+EBTNodeResult::Type UBTTask_FindMoveGoal::SetMoveGoal(UBehaviorTreeComponent& OwnerComp, const FVector& Goal)
+{
+	AShooterAIController* MyController = Cast<AShooterAIController>(OwnerComp.GetAIOwner());
+	AShooterGameMode* GameMode = MyController ? MyController->GetWorld()->GetAuthGameMode<AShooterGameMode>() : NULL;
+	if (GameMode == NULL || !FShooterBotPathQueue::IsEnabled())
+	{
+		OwnerComp.GetBlackboardComponent()->SetValue<UBlackboardKeyType_Vector>(BlackboardKey.GetSelectedKeyID(), Goal);
+		return EBTNodeResult::Succeeded;
+	}
+
+	GameMode->GetBotPathQueue().RequestPath(MyController, Goal,
+		FOnShooterBotPathReady::CreateUObject(this, &UBTTask_FindMoveGoal::OnMoveGoalPathReady, TWeakObjectPtr<UBehaviorTreeComponent>(&OwnerComp), Goal));
+
+	return EBTNodeResult::InProgress;
+}
+
+void UBTTask_FindMoveGoal::OnMoveGoalPathReady(bool bPathFound, TWeakObjectPtr<UBehaviorTreeComponent> OwnerComp, FVector Goal)
+{
+	if (!OwnerComp.IsValid())
+	{
+		return;
+	}
+
+	if (bPathFound)
+	{
+		OwnerComp->GetBlackboardComponent()->SetValue<UBlackboardKeyType_Vector>(BlackboardKey.GetSelectedKeyID(), Goal);
+	}
+
+	FinishLatentTask(*OwnerComp, bPathFound ? EBTNodeResult::Succeeded : EBTNodeResult::Failed);
+}
+
+EBTNodeResult::Type UBTTask_FindMoveGoal::AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	AShooterAIController* MyController = Cast<AShooterAIController>(OwnerComp.GetAIOwner());
+	AShooterGameMode* GameMode = MyController ? MyController->GetWorld()->GetAuthGameMode<AShooterGameMode>() : NULL;
+	if (GameMode)
+	{
+		GameMode->GetBotPathQueue().CancelRequest(MyController);
+	}
+
+	return Super::AbortTask(OwnerComp, NodeMemory);
+}
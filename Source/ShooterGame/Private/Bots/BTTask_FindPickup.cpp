@@ -10,6 +10,8 @@
 #include "Pickups/ShooterPickup_Ammo.h"
 #include "Weapons/ShooterWeapon_Instant.h"
 
+DECLARE_CYCLE_STAT(TEXT("Bot Find Pickup"), STAT_ShooterBotFindPickup, STATGROUP_ShooterGame);
+
 UBTTask_FindPickup::UBTTask_FindPickup(const FObjectInitializer& ObjectInitializer) 
 	: Super(ObjectInitializer)
 {
@@ -17,6 +19,8 @@ UBTTask_FindPickup::UBTTask_FindPickup(const FObjectInitializer& ObjectInitializ
 
 EBTNodeResult::Type UBTTask_FindPickup::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterBotFindPickup, ShooterBots, FindPickup);
+
 	AShooterAIController* MyController = Cast<AShooterAIController>(OwnerComp.GetAIOwner());
 	AShooterBot* MyBot = MyController ? Cast<AShooterBot>(MyController->GetPawn()) : NULL;
 	if (MyBot == NULL)
@@ -50,8 +54,7 @@ EBTNodeResult::Type UBTTask_FindPickup::ExecuteTask(UBehaviorTreeComponent& Owne
 
 	if (BestPickup)
 	{
-		OwnerComp.GetBlackboardComponent()->SetValue<UBlackboardKeyType_Vector>(BlackboardKey.GetSelectedKeyID(), BestPickup->GetActorLocation());
-		return EBTNodeResult::Succeeded;
+		return SetMoveGoal(OwnerComp, BestPickup->GetActorLocation());
 	}
 
 	return EBTNodeResult::Failed;
@@ -8,6 +8,7 @@
 #include "BehaviorTree/Blackboard/BlackboardKeyAllTypes.h"
 #include "NavigationSystem.h"
 
+DECLARE_CYCLE_STAT(TEXT("Bot Find Point Near Enemy"), STAT_ShooterBotFindPointNearEnemy, STATGROUP_ShooterGame);
 
 UBTTask_FindPointNearEnemy::UBTTask_FindPointNearEnemy(const FObjectInitializer& ObjectInitializer) 
 	: Super(ObjectInitializer)
@@ -16,6 +17,8 @@ UBTTask_FindPointNearEnemy::UBTTask_FindPointNearEnemy(const FObjectInitializer&
 
 EBTNodeResult::Type UBTTask_FindPointNearEnemy::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterBotFindPointNearEnemy, ShooterBots, FindPointNearEnemy);
+
 	AShooterAIController* MyController = Cast<AShooterAIController>(OwnerComp.GetAIOwner());
 	if (MyController == NULL)
 	{
@@ -32,8 +35,7 @@ EBTNodeResult::Type UBTTask_FindPointNearEnemy::ExecuteTask(UBehaviorTreeCompone
 		UNavigationSystemV1::K2_GetRandomReachablePointInRadius(MyController, SearchOrigin, Loc, SearchRadius);
 		if (Loc != FVector::ZeroVector)
 		{
-			OwnerComp.GetBlackboardComponent()->SetValue<UBlackboardKeyType_Vector>(BlackboardKey.GetSelectedKeyID(), Loc);
-			return EBTNodeResult::Succeeded;
+			return SetMoveGoal(OwnerComp, Loc);
 		}
 	}
 
@@ -3,6 +3,8 @@
 #include "ShooterGame.h"
 #include "Bots/ShooterAIController.h"
 #include "Bots/ShooterBot.h"
+#include "Bots/ShooterBehaviorTreeComponent.h"
+#include "Online/ShooterTickRateGovernor.h"
 #include "Online/ShooterPlayerState.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
@@ -10,14 +12,35 @@
 #include "BehaviorTree/Blackboard/BlackboardKeyType_Bool.h"
 #include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
 #include "Weapons/ShooterWeapon.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "NavigationSystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Bot Find Enemy"), STAT_ShooterBotFindEnemy, STATGROUP_ShooterGame);
+DECLARE_CYCLE_STAT(TEXT("Bot Shoot Enemy"), STAT_ShooterBotShootEnemy, STATGROUP_ShooterGame);
+
+static float ShooterBotPrecomputedPathMaxDrift = 150.0f;
+FAutoConsoleVariableRef CVarShooterBotPrecomputedPathMaxDrift(
+	TEXT("ShooterBot.PrecomputedPathMaxDrift"),
+	ShooterBotPrecomputedPathMaxDrift,
+	TEXT("Max distance between bot and start of asynchronously computed path, before it is discarded."),
+	ECVF_Default);
+
+static float ShooterBotThinkRate = 0.0f;
+FAutoConsoleVariableRef CVarShooterBotThinkRate(
+	TEXT("ShooterBot.ThinkRate"),
+	ShooterBotThinkRate,
+	TEXT("Times per second bots run behavior tree on servers, 0 uses NetServerMaxTickRate from config. Kept when server tick rate changes."),
+	ECVF_Default);
 
 AShooterAIController::AShooterAIController(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
  	BlackboardComp = ObjectInitializer.CreateDefaultSubobject<UBlackboardComponent>(this, TEXT("BlackBoardComp"));
  	
-	BrainComponent = BehaviorComp = ObjectInitializer.CreateDefaultSubobject<UBehaviorTreeComponent>(this, TEXT("BehaviorComp"));	
+	BrainComponent = BehaviorComp = ObjectInitializer.CreateDefaultSubobject<UShooterBehaviorTreeComponent>(this, TEXT("BehaviorComp"));	
 
 	bWantsPlayerState = true;
+
+	PrecomputedPathGoal = FVector::ZeroVector;
 }
 
 void AShooterAIController::OnPossess(APawn* InPawn)
@@ -39,6 +62,26 @@ void AShooterAIController::OnPossess(APawn* InPawn)
 
 		BehaviorComp->StartTree(*(Bot->BotBehavior));
 	}
+
+	UpdateThinkInterval();
+}
+
+void AShooterAIController::UpdateThinkInterval()
+{
+	FShooterTickRateGovernor* Governor = FShooterTickRateGovernor::Get(this);
+	UShooterBehaviorTreeComponent* ShooterBehaviorComp = Cast<UShooterBehaviorTreeComponent>(BehaviorComp);
+	if (Governor == NULL || ShooterBehaviorComp == NULL || Governor->GetTickRate() <= 0)
+	{
+		return;
+	}
+
+	// think every few frames, so rate in real time doesn't change with server tick rate
+	const float TickRate = Governor->GetTickRate();
+	const float ThinkRate = ShooterBotThinkRate > 0.0f ? ShooterBotThinkRate : Governor->GetConfiguredTickRate();
+	const int32 ThinkPeriodFrames = ThinkRate > 0.0f ? FMath::Max(FMath::RoundToInt(TickRate / ThinkRate), 1) : 1;
+
+	// half a frame early, frame time jitter shouldn't push thinking to frame after
+	ShooterBehaviorComp->SetThinkInterval(ThinkPeriodFrames > 1 ? (ThinkPeriodFrames - 0.5f) / TickRate : 0.0f);
 }
 
 void AShooterAIController::OnUnPossess()
@@ -97,6 +140,8 @@ void AShooterAIController::FindClosestEnemy()
 
 bool AShooterAIController::FindClosestEnemyWithLOS(AShooterCharacter* ExcludeEnemy)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterBotFindEnemy, ShooterBots, FindEnemy);
+
 	bool bGotEnemy = false;
 	APawn* MyBot = GetPawn();
 	if (MyBot != NULL)
@@ -129,6 +174,34 @@ bool AShooterAIController::FindClosestEnemyWithLOS(AShooterCharacter* ExcludeEne
 	return bGotEnemy;
 }
 
+bool AShooterAIController::FindInfluenceLocation(bool bAdvance, float SearchRadius, FVector& OutLocation) const
+{
+	APawn* MyBot = GetPawn();
+	AShooterGameMode* GameMode = GetWorld()->GetAuthGameMode<AShooterGameMode>();
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (MyBot == NULL || GameMode == NULL || NavSys == NULL)
+	{
+		return false;
+	}
+
+	AShooterPlayerState* MyPlayerState = Cast<AShooterPlayerState>(PlayerState);
+	const FShooterTeamInfluenceMap& InfluenceMap = GameMode->GetTeamInfluenceMap();
+
+	FVector CellLocation;
+	if (InfluenceMap.FindLocationNear(MyBot->GetActorLocation(), SearchRadius, MyPlayerState ? MyPlayerState->GetTeamNum() : 0, bAdvance, CellLocation, MyPlayerState))
+	{
+		const float HalfCell = InfluenceMap.GetCellSize() * 0.5f;
+		FNavLocation NavLocation;
+		if (NavSys->ProjectPointToNavigation(CellLocation, NavLocation, FVector(HalfCell, HalfCell, 500.0f)))
+		{
+			OutLocation = NavLocation.Location;
+			return true;
+		}
+	}
+
+	return false;
+}
+
 bool AShooterAIController::HasWeaponLOSToEnemy(AActor* InEnemyActor, const bool bAnyEnemy) const
 {
 	
@@ -182,6 +255,8 @@ bool AShooterAIController::HasWeaponLOSToEnemy(AActor* InEnemyActor, const bool
 
 void AShooterAIController::ShootEnemy()
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterBotShootEnemy, ShooterBots, ShootEnemy);
+
 	AShooterBot* MyBot = Cast<AShooterBot>(GetPawn());
 	AShooterWeapon* MyWeapon = MyBot ? MyBot->GetWeapon() : NULL;
 	if (MyWeapon == NULL)
@@ -263,6 +338,39 @@ void AShooterAIController::UpdateControlRotation(float DeltaTime, bool bUpdatePa
 	}
 }
 
+void AShooterAIController::SetPrecomputedPath(const FVector& Goal, FNavPathSharedPtr Path)
+{
+	PrecomputedPath = Path;
+	PrecomputedPathGoal = Goal;
+}
+
+FPathFollowingRequestResult AShooterAIController::MoveTo(const FAIMoveRequest& MoveRequest, FNavPathSharedPtr* OutPath)
+{
+	FNavPathSharedPtr Path = PrecomputedPath;
+	PrecomputedPath.Reset();
+
+	const bool bCanUsePath = Path.IsValid() && Path->IsValid() && GetPawn() &&
+		MoveRequest.IsValid() && MoveRequest.IsUsingPathfinding() && !MoveRequest.IsMoveToActorRequest() &&
+		MoveRequest.GetGoalLocation().Equals(PrecomputedPathGoal, 1.0f) &&
+		FVector::DistSquared(Path->GetPathPoints()[0].Location, GetNavAgentLocation()) <= FMath::Square(ShooterBotPrecomputedPathMaxDrift);
+
+	if (bCanUsePath)
+	{
+		FPathFollowingRequestResult Result;
+		Result.MoveId = RequestMove(MoveRequest, Path);
+		Result.Code = Result.MoveId.IsValid() ? EPathFollowingRequestResult::RequestSuccessful : EPathFollowingRequestResult::Failed;
+
+		if (OutPath)
+		{
+			*OutPath = Path;
+		}
+
+		return Result;
+	}
+
+	return Super::MoveTo(MoveRequest, OutPath);
+}
+
 void AShooterAIController::GameHasEnded(AActor* EndGameFocus, bool bIsWinner)
 {
 	// Stop the behaviour tree/logic
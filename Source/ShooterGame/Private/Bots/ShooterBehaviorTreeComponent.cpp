@@ -0,0 +1,34 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Bots/ShooterBehaviorTreeComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Bot Think"), STAT_ShooterBotThink, STATGROUP_ShooterGame);
+
+UShooterBehaviorTreeComponent::UShooterBehaviorTreeComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	ThinkInterval = 0.0f;
+	SkippedDeltaTime = 0.0f;
+}
+
+void UShooterBehaviorTreeComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	SkippedDeltaTime += DeltaTime;
+	if (SkippedDeltaTime < ThinkInterval)
+	{
+		return;
+	}
+
+	// tree gets whole time since its last run, same as when it skips ticks itself
+	const float ThinkDeltaTime = SkippedDeltaTime;
+	SkippedDeltaTime = 0.0f;
+
+	SCOPE_CYCLE_COUNTER(STAT_ShooterBotThink);
+	Super::TickComponent(ThinkDeltaTime, TickType, ThisTickFunction);
+}
+
+void UShooterBehaviorTreeComponent::SetThinkInterval(float InThinkInterval)
+{
+	ThinkInterval = FMath::Max(InThinkInterval, 0.0f);
+}
@@ -4,6 +4,21 @@
 #include "Bots/ShooterBot.h"
 #include "Bots/ShooterAIController.h"
 
+static int32 ShooterBotMovementLOD = 1;
+FAutoConsoleVariableRef CVarShooterBotMovementLOD(
+	TEXT("ShooterBot.MovementLOD"),
+	ShooterBotMovementLOD,
+	TEXT("Use navmesh walking at reduced tick rate for bots outside relevancy range of all players.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+static float ShooterBotMovementLODCheckInterval = 0.5f;
+FAutoConsoleVariableRef CVarShooterBotMovementLODCheckInterval(
+	TEXT("ShooterBot.MovementLODCheckInterval"),
+	ShooterBotMovementLODCheckInterval,
+	TEXT("How often bots check distance to players for movement LOD, in seconds."),
+	ECVF_Default);
+
 AShooterBot::AShooterBot(const FObjectInitializer& ObjectInitializer) 
 	: Super(ObjectInitializer)
 {
@@ -25,3 +40,52 @@ void AShooterBot::FaceRotation(FRotator NewRotation, float DeltaTime)
 
 	Super::FaceRotation(CurrentRotation, DeltaTime);
 }
+
+void AShooterBot::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (GetLocalRole() == ROLE_Authority)
+	{
+		// random first delay spreads the checks of bots spawned in the same frame
+		const float Interval = FMath::Max(ShooterBotMovementLODCheckInterval, 0.1f);
+		GetWorldTimerManager().SetTimer(TimerHandle_MovementLOD, this, &AShooterBot::UpdateMovementLOD, Interval, true, FMath::FRandRange(0.0f, Interval));
+	}
+}
+
+void AShooterBot::UpdateMovementLOD()
+{
+	UShooterCharacterMovement* MoveComp = Cast<UShooterCharacterMovement>(GetCharacterMovement());
+	if (MoveComp == NULL || !IsAlive())
+	{
+		return;
+	}
+
+	bool bNearPlayer = (ShooterBotMovementLOD == 0);
+	if (!bNearPlayer)
+	{
+		// a bit of hysteresis, so bots at range edge don't flip every check
+		const float RangeScale = MoveComp->IsReducedMovementLOD() ? 1.0f : 1.2f;
+		const float RangeSq = NetCullDistanceSquared * FMath::Square(RangeScale);
+		const FVector MyLoc = GetActorLocation();
+
+		for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+		{
+			APlayerController* PC = It->Get();
+			if (PC)
+			{
+				FVector ViewLocation;
+				FRotator ViewRotation;
+				PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+				if (FVector::DistSquared(ViewLocation, MyLoc) < RangeSq)
+				{
+					bNearPlayer = true;
+					break;
+				}
+			}
+		}
+	}
+
+	MoveComp->SetReducedMovementLOD(!bNearPlayer);
+}
@@ -0,0 +1,157 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Bots/ShooterBotPathQueue.h"
+#include "Bots/ShooterAIController.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+
+static int32 ShooterBotAsyncPathfinding = 1;
+FAutoConsoleVariableRef CVarShooterBotAsyncPathfinding(
+	TEXT("ShooterBot.AsyncPathfinding"),
+	ShooterBotAsyncPathfinding,
+	TEXT("Resolve bot move goals on navigation worker tasks instead of the game thread.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+static int32 ShooterBotMaxPathRequestsPerFrame = 4;
+FAutoConsoleVariableRef CVarShooterBotMaxPathRequestsPerFrame(
+	TEXT("ShooterBot.MaxPathRequestsPerFrame"),
+	ShooterBotMaxPathRequestsPerFrame,
+	TEXT("Max number of bot path requests dispatched to the navigation system each frame."),
+	ECVF_Default);
+
+static int32 ShooterBotMaxPathRequestsInFlight = 16;
+FAutoConsoleVariableRef CVarShooterBotMaxPathRequestsInFlight(
+	TEXT("ShooterBot.MaxPathRequestsInFlight"),
+	ShooterBotMaxPathRequestsInFlight,
+	TEXT("Max number of bot path requests waiting for results at the same time."),
+	ECVF_Default);
+
+FShooterBotPathQueue::~FShooterBotPathQueue()
+{
+	Reset();
+}
+
+void FShooterBotPathQueue::Initialize(UWorld* InWorld)
+{
+	World = InWorld;
+}
+
+bool FShooterBotPathQueue::IsEnabled()
+{
+	return ShooterBotAsyncPathfinding > 0;
+}
+
+void FShooterBotPathQueue::RequestPath(AShooterAIController* Bot, const FVector& Goal, const FOnShooterBotPathReady& OnReady)
+{
+	// re-queue at the end, so bots asking more often don't starve others
+	CancelRequest(Bot);
+
+	FBotPathRequest& Request = QueuedRequests.AddDefaulted_GetRef();
+	Request.Bot = Bot;
+	Request.Goal = Goal;
+	Request.OnReady = OnReady;
+}
+
+void FShooterBotPathQueue::CancelRequest(AShooterAIController* Bot)
+{
+	QueuedRequests.RemoveAll([Bot](const FBotPathRequest& Request) { return Request.Bot == Bot; });
+
+	UWorld* MyWorld = World.Get();
+	UNavigationSystemV1* NavSys = MyWorld ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(MyWorld) : nullptr;
+	for (auto It = InFlightRequests.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Bot == Bot)
+		{
+			if (NavSys)
+			{
+				NavSys->AbortAsyncFindPathRequest(It.Key());
+			}
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FShooterBotPathQueue::Reset()
+{
+	UWorld* MyWorld = World.Get();
+	UNavigationSystemV1* NavSys = MyWorld ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(MyWorld) : nullptr;
+	if (NavSys)
+	{
+		for (const TPair<uint32, FBotPathRequest>& InFlight : InFlightRequests)
+		{
+			NavSys->AbortAsyncFindPathRequest(InFlight.Key);
+		}
+	}
+
+	InFlightRequests.Empty();
+	QueuedRequests.Empty();
+}
+
+void FShooterBotPathQueue::Tick()
+{
+	UWorld* MyWorld = World.Get();
+	UNavigationSystemV1* NavSys = MyWorld ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(MyWorld) : nullptr;
+	if (NavSys == nullptr || QueuedRequests.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 Budget = FMath::Min(ShooterBotMaxPathRequestsPerFrame, ShooterBotMaxPathRequestsInFlight - InFlightRequests.Num());
+
+	// delegates may queue new requests, call them after the queue is updated
+	TArray<FOnShooterBotPathReady> FailedRequests;
+
+	int32 NumProcessed = 0;
+	int32 NumDispatched = 0;
+	for (; NumProcessed < QueuedRequests.Num() && NumDispatched < Budget; ++NumProcessed)
+	{
+		FBotPathRequest& Request = QueuedRequests[NumProcessed];
+		AShooterAIController* Bot = Request.Bot.Get();
+		if (Bot == nullptr)
+		{
+			continue;
+		}
+
+		FAIMoveRequest MoveRequest(Request.Goal);
+		FPathFindingQuery Query;
+		if (Bot->GetPawn() == nullptr || !Bot->BuildPathfindingQuery(MoveRequest, Query))
+		{
+			FailedRequests.Add(Request.OnReady);
+			continue;
+		}
+
+		const uint32 QueryId = NavSys->FindPathAsync(Bot->GetNavAgentPropertiesRef(), Query,
+			FNavPathQueryDelegate::CreateRaw(this, &FShooterBotPathQueue::OnPathFound));
+
+		InFlightRequests.Add(QueryId, MoveTemp(Request));
+		NumDispatched++;
+	}
+
+	QueuedRequests.RemoveAt(0, NumProcessed, false);
+
+	for (const FOnShooterBotPathReady& OnReady : FailedRequests)
+	{
+		OnReady.ExecuteIfBound(false);
+	}
+}
+
+void FShooterBotPathQueue::OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+{
+	FBotPathRequest Request;
+	if (!InFlightRequests.RemoveAndCopyValue(QueryId, Request))
+	{
+		// cancelled
+		return;
+	}
+
+	AShooterAIController* Bot = Request.Bot.Get();
+	const bool bPathFound = Bot && Result == ENavigationQueryResult::Success && Path.IsValid() && Path->IsValid();
+	if (bPathFound)
+	{
+		Bot->SetPrecomputedPath(Request.Goal, Path);
+	}
+
+	Request.OnReady.ExecuteIfBound(bPathFound);
+}
@@ -32,7 +32,7 @@ void AShooterExplosionEffect::BeginPlay()
 
 	if (ExplosionSound)
 	{
-		UGameplayStatics::PlaySoundAtLocation(this, ExplosionSound, GetActorLocation());
+		FShooterAudioManager::PlaySoundAtLocation(this, EShooterSoundCategory::Impact, ExplosionSound, GetActorLocation());
 	}
 
 	if (Decal.DecalMaterial)
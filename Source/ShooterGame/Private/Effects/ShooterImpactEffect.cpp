@@ -3,6 +3,8 @@
 #include "ShooterGame.h"
 #include "ShooterImpactEffect.h"
 
+DECLARE_CYCLE_STAT(TEXT("Impact Effect Spawn"), STAT_ShooterImpactEffectSpawn, STATGROUP_ShooterGame);
+
 AShooterImpactEffect::AShooterImpactEffect(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	SetAutoDestroyWhenFinished(true);
@@ -10,6 +12,9 @@ AShooterImpactEffect::AShooterImpactEffect(const FObjectInitializer& ObjectIniti
 
 void AShooterImpactEffect::PostInitializeComponents()
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterImpactEffectSpawn, ShooterEffects, ImpactEffect);
+	SHOOTER_LLM_SCOPE(Effects);
+
 	Super::PostInitializeComponents();
 
 	UPhysicalMaterial* HitPhysMat = SurfaceHit.PhysMaterial.Get();
@@ -26,7 +31,7 @@ void AShooterImpactEffect::PostInitializeComponents()
 	USoundCue* ImpactSound = GetImpactSound(HitSurfaceType);
 	if (ImpactSound)
 	{
-		UGameplayStatics::PlaySoundAtLocation(this, ImpactSound, GetActorLocation());
+		FShooterAudioManager::PlaySoundAtLocation(this, EShooterSoundCategory::Impact, ImpactSound, GetActorLocation());
 	}
 
 	if (DefaultDecal.DecalMaterial)
@@ -0,0 +1,304 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Effects/ShooterImpactEffectManager.h"
+#include "Effects/ShooterImpactEffect.h"
+#include "Components/DecalComponent.h"
+#include "Particles/ParticleSystemComponent.h"
+
+static int32 ShooterFXMaxParticlesPerFrame = 8;
+FAutoConsoleVariableRef CVarShooterFXMaxParticlesPerFrame(
+	TEXT("ShooterFX.MaxParticlesPerFrame"),
+	ShooterFXMaxParticlesPerFrame,
+	TEXT("Max impact emitters started in a single frame."),
+	ECVF_Default);
+
+static int32 ShooterFXMaxSoundsPerFrame = 4;
+FAutoConsoleVariableRef CVarShooterFXMaxSoundsPerFrame(
+	TEXT("ShooterFX.MaxSoundsPerFrame"),
+	ShooterFXMaxSoundsPerFrame,
+	TEXT("Max impact sounds started in a single frame."),
+	ECVF_Default);
+
+static int32 ShooterFXMaxDecalsPerFrame = 8;
+FAutoConsoleVariableRef CVarShooterFXMaxDecalsPerFrame(
+	TEXT("ShooterFX.MaxDecalsPerFrame"),
+	ShooterFXMaxDecalsPerFrame,
+	TEXT("Max impact decals placed in a single frame."),
+	ECVF_Default);
+
+static int32 ShooterFXMaxActiveParticles = 48;
+FAutoConsoleVariableRef CVarShooterFXMaxActiveParticles(
+	TEXT("ShooterFX.MaxActiveParticles"),
+	ShooterFXMaxActiveParticles,
+	TEXT("Max impact emitters playing at the same time."),
+	ECVF_Default);
+
+static int32 ShooterFXDecalRingSize = 64;
+FAutoConsoleVariableRef CVarShooterFXDecalRingSize(
+	TEXT("ShooterFX.DecalRingSize"),
+	ShooterFXDecalRingSize,
+	TEXT("Number of impact decals, the oldest one is moved when more are needed."),
+	ECVF_Default);
+
+static float ShooterFXParticleCullDistance = 6000.0f;
+FAutoConsoleVariableRef CVarShooterFXParticleCullDistance(
+	TEXT("ShooterFX.ParticleCullDistance"),
+	ShooterFXParticleCullDistance,
+	TEXT("Impacts further from local viewers don't spawn emitters."),
+	ECVF_Default);
+
+static float ShooterFXSoundCullDistance = 4000.0f;
+FAutoConsoleVariableRef CVarShooterFXSoundCullDistance(
+	TEXT("ShooterFX.SoundCullDistance"),
+	ShooterFXSoundCullDistance,
+	TEXT("Impacts further from local viewers don't play sounds."),
+	ECVF_Default);
+
+static float ShooterFXDecalCullDistance = 3000.0f;
+FAutoConsoleVariableRef CVarShooterFXDecalCullDistance(
+	TEXT("ShooterFX.DecalCullDistance"),
+	ShooterFXDecalCullDistance,
+	TEXT("Impacts further from local viewers don't place decals."),
+	ECVF_Default);
+
+FShooterImpactEffectManager::FShooterImpactEffectManager()
+	: NextDecal(0)
+{
+}
+
+void FShooterImpactEffectManager::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(DecalRing);
+}
+
+void FShooterImpactEffectManager::Initialize(UWorld* InWorld)
+{
+	World = InWorld;
+}
+
+FShooterImpactEffectManager* FShooterImpactEffectManager::Get(const UObject* WorldContextObject)
+{
+	UWorld* MyWorld = WorldContextObject ? WorldContextObject->GetWorld() : NULL;
+	AShooterGameState* GameState = MyWorld ? MyWorld->GetGameState<AShooterGameState>() : NULL;
+	return GameState ? &GameState->GetImpactEffectManager() : NULL;
+}
+
+void FShooterImpactEffectManager::AddImpact(TSubclassOf<AShooterImpactEffect> Template, const FHitResult& Impact)
+{
+	UWorld* MyWorld = World.Get();
+	if (Template && MyWorld && MyWorld->GetNetMode() != NM_DedicatedServer)
+	{
+		FImpactRequest& Request = PendingImpacts.AddDefaulted_GetRef();
+		Request.Template = Template;
+		Request.Impact = Impact;
+		Request.DistanceSq = MAX_FLT;
+	}
+}
+
+void FShooterImpactEffectManager::Tick()
+{
+	UWorld* MyWorld = World.Get();
+	if (MyWorld == NULL)
+	{
+		return;
+	}
+
+	HideExpiredDecals();
+
+	if (PendingImpacts.Num() == 0)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ShooterImpactEffectManager_Tick);
+
+	TArray<FVector> ViewLocations;
+	for (FConstPlayerControllerIterator It = MyWorld->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	for (FImpactRequest& Request : PendingImpacts)
+	{
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			Request.DistanceSq = FMath::Min(Request.DistanceSq, FVector::DistSquared(ViewLocation, Request.Impact.ImpactPoint));
+		}
+	}
+
+	// closest impacts matter most, they get budget first
+	PendingImpacts.Sort([](const FImpactRequest& A, const FImpactRequest& B) { return A.DistanceSq < B.DistanceSq; });
+
+	ActiveParticles.RemoveAllSwap([](const TWeakObjectPtr<UParticleSystemComponent>& PSC) { return !PSC.IsValid() || !PSC->IsActive(); });
+
+	const float ParticleCullDistanceSq = FMath::Square(ShooterFXParticleCullDistance);
+	const float SoundCullDistanceSq = FMath::Square(ShooterFXSoundCullDistance);
+	const float DecalCullDistanceSq = FMath::Square(ShooterFXDecalCullDistance);
+
+	int32 NumParticles = 0;
+	int32 NumSounds = 0;
+	int32 NumDecals = 0;
+	for (const FImpactRequest& Request : PendingImpacts)
+	{
+		const bool bParticles = Request.DistanceSq <= ParticleCullDistanceSq && NumParticles < ShooterFXMaxParticlesPerFrame && ActiveParticles.Num() < ShooterFXMaxActiveParticles;
+		const bool bSound = Request.DistanceSq <= SoundCullDistanceSq && NumSounds < ShooterFXMaxSoundsPerFrame;
+		const bool bDecal = Request.DistanceSq <= DecalCullDistanceSq && NumDecals < ShooterFXMaxDecalsPerFrame && ShooterFXDecalRingSize > 0;
+		if (!bParticles && !bSound && !bDecal)
+		{
+			// sorted by distance, but budgets may still allow decals or sounds of further impacts
+			if (Request.DistanceSq > ParticleCullDistanceSq && Request.DistanceSq > SoundCullDistanceSq && Request.DistanceSq > DecalCullDistanceSq)
+			{
+				break;
+			}
+			continue;
+		}
+
+		const AShooterImpactEffect* Effect = Request.Template->GetDefaultObject<AShooterImpactEffect>();
+		const FHitResult Impact = ResolveSurface(Request.Impact);
+		const EPhysicalSurface SurfaceType = UPhysicalMaterial::DetermineSurfaceType(Impact.PhysMaterial.Get());
+
+		UParticleSystem* ImpactFX = bParticles ? Effect->GetImpactFX(SurfaceType) : NULL;
+		if (ImpactFX)
+		{
+			UParticleSystemComponent* PSC = UGameplayStatics::SpawnEmitterAtLocation(MyWorld, ImpactFX, Request.Impact.ImpactPoint, Request.Impact.ImpactNormal.Rotation(),
+				FVector(1.0f), true, EPSCPoolMethod::AutoRelease);
+			if (PSC)
+			{
+				ActiveParticles.Add(PSC);
+				NumParticles++;
+			}
+		}
+
+		// concurrent impact sounds are limited by audio manager's voice budget
+		USoundCue* ImpactSound = bSound ? Effect->GetImpactSound(SurfaceType) : NULL;
+		if (ImpactSound)
+		{
+			FShooterAudioManager::PlaySoundAtLocation(MyWorld, EShooterSoundCategory::Impact, ImpactSound, Request.Impact.ImpactPoint);
+			NumSounds++;
+		}
+
+		if (bDecal && Effect->DefaultDecal.DecalMaterial)
+		{
+			PlaceDecal(Effect, Impact);
+			NumDecals++;
+		}
+	}
+
+	PendingImpacts.Reset();
+}
+
+FHitResult FShooterImpactEffectManager::ResolveSurface(const FHitResult& Impact) const
+{
+	if (Impact.Component.IsValid() && Impact.PhysMaterial.IsValid())
+	{
+		return Impact;
+	}
+
+	// trace again to find component lost during replication
+	FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(ImpactEffectTrace), true);
+	TraceParams.bReturnPhysicalMaterial = true;
+
+	const FVector StartTrace = Impact.ImpactPoint + Impact.ImpactNormal * 10.0f;
+	const FVector EndTrace = Impact.ImpactPoint - Impact.ImpactNormal * 10.0f;
+	FHitResult Hit;
+	if (World->LineTraceSingleByChannel(Hit, StartTrace, EndTrace, COLLISION_WEAPON, TraceParams))
+	{
+		return Hit;
+	}
+
+	return Impact;
+}
+
+void FShooterImpactEffectManager::PlaceDecal(const AShooterImpactEffect* Effect, const FHitResult& Impact)
+{
+	UWorld* MyWorld = World.Get();
+
+	// ring shrunk through cvar
+	if (DecalRing.Num() > ShooterFXDecalRingSize)
+	{
+		for (int32 Idx = ShooterFXDecalRingSize; Idx < DecalRing.Num(); Idx++)
+		{
+			if (DecalRing[Idx] && !DecalRing[Idx]->IsPendingKill())
+			{
+				DecalRing[Idx]->DestroyComponent();
+			}
+		}
+		DecalRing.SetNum(FMath::Max(ShooterFXDecalRingSize, 0));
+		DecalHideTimes.SetNum(DecalRing.Num());
+	}
+
+	if (NextDecal >= ShooterFXDecalRingSize)
+	{
+		NextDecal = 0;
+	}
+
+	UDecalComponent* Decal = DecalRing.IsValidIndex(NextDecal) ? DecalRing[NextDecal] : NULL;
+	if (Decal == NULL || Decal->IsPendingKill())
+	{
+		Decal = NewObject<UDecalComponent>(MyWorld);
+		Decal->bAllowAnyoneToDestroyMe = true;
+		Decal->RegisterComponentWithWorld(MyWorld);
+
+		if (DecalRing.IsValidIndex(NextDecal))
+		{
+			DecalRing[NextDecal] = Decal;
+		}
+		else
+		{
+			DecalRing.Add(Decal);
+			DecalHideTimes.Add(0.0f);
+		}
+	}
+
+	const int32 DecalIdx = NextDecal++;
+
+	FRotator RandomDecalRotation = Impact.ImpactNormal.Rotation();
+	RandomDecalRotation.Roll = FMath::FRandRange(-180.0f, 180.0f);
+
+	Decal->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	Decal->SetDecalMaterial(Effect->DefaultDecal.DecalMaterial);
+	Decal->DecalSize = FVector(1.0f, Effect->DefaultDecal.DecalSize, Effect->DefaultDecal.DecalSize);
+	Decal->SetWorldLocationAndRotation(Impact.ImpactPoint, RandomDecalRotation);
+
+	USceneComponent* HitComponent = Impact.Component.Get();
+	if (HitComponent && HitComponent->Mobility == EComponentMobility::Movable)
+	{
+		Decal->AttachToComponent(HitComponent, FAttachmentTransformRules::KeepWorldTransform, Impact.BoneName);
+	}
+
+	// SetFadeOut would start a life span timer destroying the component, set fade directly and hide it ourselves
+	const float LifeSpan = Effect->DefaultDecal.LifeSpan;
+	Decal->FadeStartDelay = LifeSpan;
+	Decal->FadeDuration = LifeSpan > 0.0f ? 1.0f : 0.0f;
+	Decal->bDestroyOwnerAfterFade = false;
+	Decal->SetVisibility(true);
+	Decal->MarkRenderStateDirty();
+
+	DecalHideTimes[DecalIdx] = LifeSpan > 0.0f ? MyWorld->GetTimeSeconds() + LifeSpan + 1.0f : 0.0f;
+}
+
+void FShooterImpactEffectManager::HideExpiredDecals()
+{
+	const float Now = World->GetTimeSeconds();
+	for (int32 Idx = 0; Idx < DecalRing.Num(); Idx++)
+	{
+		if (DecalHideTimes[Idx] > 0.0f && DecalHideTimes[Idx] <= Now)
+		{
+			DecalHideTimes[Idx] = 0.0f;
+
+			UDecalComponent* Decal = DecalRing[Idx];
+			if (Decal && !Decal->IsPendingKill())
+			{
+				Decal->SetVisibility(false);
+			}
+		}
+	}
+}
@@ -3,9 +3,15 @@
 #include "Components/StaticMeshComponent.h"
 #include "Components/SphereComponent.h"
 #include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
 
 #include "NiagaraFunctionLibrary.h"
 
+#include "Online/ShooterGameMode.h"
+#include "Weapons/ShooterRadialDamage.h"
+#include "Player/ShooterCharacter.h"
+
 AShooterGameGrenade::AShooterGameGrenade(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
 {
@@ -16,45 +22,248 @@ AShooterGameGrenade::AShooterGameGrenade(const FObjectInitializer& ObjectInitial
     ExplosionRadiusSphereComponent->SetRelativeTransform(FTransform::Identity);
     ExplosionRadiusSphereComponent->AttachToComponent(GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
 
-    // Only care about pawns within the explosion radius
-    ExplosionRadiusSphereComponent->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
-    ExplosionRadiusSphereComponent->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
+    // Only used for visualizing the radius, damage is gathered by the radial damage service
+    ExplosionRadiusSphereComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
     BlastTraceChannel = COLLISION_BLAST;
     ExposionVFXScale = FVector::OneVector;
+
+    // Clients simulate the trajectory from the launch info, only the detonation is replicated afterwards
+    bReplicates = true;
+    SetReplicatingMovement(false);
+    NetUpdateFrequency = 10.0f;
+
+    MaxFuseCompensation = 0.25f;
+    PredictionTimeout = 1.0f;
+    bPredicted = false;
+    bDetonated = false;
 }
 
 void AShooterGameGrenade::BeginPlay()
 {
     Super::BeginPlay();
 
-    if (GetWorld())
+    UpdateExplosionRadiusSphereComponent();
+
+    if (GetWorld() == nullptr)
     {
-        if (DetonationDelay > 0.0f)
-        {
-            GetWorld()->GetTimerManager().SetTimer(DetonationTimer, this, &AShooterGameGrenade::Detonate, DetonationDelay);
-        }
-        else
+        return;
+    }
+
+    if (bPredicted)
+    {
+        // Cosmetic copy of the throwing client, the server decides when and where it explodes
+        Launch();
+        GetWorld()->GetTimerManager().SetTimer(DetonationTimer, this, &AShooterGameGrenade::OnPredictionTimeout, FMath::Max(DetonationDelay, 0.0f) + PredictionTimeout);
+    }
+    else if (HasAuthority())
+    {
+        // Prewarmed grenades wait in the pool until they are thrown
+        FShooterProjectilePool* Pool = FShooterProjectilePool::Get(this);
+        if (Pool == nullptr || !Pool->IsInPool(this))
         {
-            Detonate();
+            StartAuthorityLaunch();
         }
     }
-    
-    UpdateExplosionRadiusSphereComponent();
+    else if (!bDetonated)
+    {
+        StartClientLaunch();
+    }
+}
+
+void AShooterGameGrenade::StartAuthorityLaunch()
+{
+    // Take the thrower's latency off the fuse, so the explosion isn't late for them
+    const float ServerTime = GetServerWorldTime();
+    const float Compensation = FMath::Clamp(ServerTime - LaunchInfo.LaunchTime, 0.0f, MaxFuseCompensation);
+    LaunchInfo.LaunchTime = ServerTime - Compensation;
+
+    Launch();
+
+    const float FuseTime = DetonationDelay - Compensation;
+    if (FuseTime > 0.0f)
+    {
+        GetWorld()->GetTimerManager().SetTimer(DetonationTimer, this, &AShooterGameGrenade::Detonate, FuseTime);
+    }
+    else
+    {
+        Detonate();
+    }
+}
+
+void AShooterGameGrenade::StartClientLaunch()
+{
+    LinkPredictedGrenade();
+
+    // Nothing represents this grenade locally yet, simulate it from the launch info
+    if (!PredictedGrenade.IsValid())
+    {
+        Launch();
+    }
+}
+
+void AShooterGameGrenade::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(AShooterGameGrenade, LaunchInfo);
+    DOREPLIFETIME(AShooterGameGrenade, bDetonated);
+    DOREPLIFETIME(AShooterGameGrenade, DetonationLocation);
+}
+
+void AShooterGameGrenade::LifeSpanExpired()
+{
+    FShooterProjectilePool* Pool = FShooterProjectilePool::Get(this);
+    if (Pool == nullptr || !Pool->ReleaseActor(this))
+    {
+        Super::LifeSpanExpired();
+    }
+}
+
+void AShooterGameGrenade::OnAcquiredFromPool()
+{
+    bDetonated = false;
+    EnableGrenade();
+    StartAuthorityLaunch();
+}
+
+void AShooterGameGrenade::OnReleasedToPool()
+{
+    if (GetWorld())
+    {
+        GetWorld()->GetTimerManager().ClearTimer(DetonationTimer);
+    }
+
+    DisableGrenade();
 }
 
 float AShooterGameGrenade::GetDetonationTimerRemaining() const
 {
     float TimeRemaining = 0.0f;
 
-    if (GetWorld())
+    // Computed from the launch time, so it matches on clients without a fuse timer
+    if (GetWorld() && !bDetonated)
     {
-        TimeRemaining = GetWorld()->GetTimerManager().GetTimerRemaining(DetonationTimer);
+        TimeRemaining = FMath::Max(DetonationDelay - (GetServerWorldTime() - LaunchInfo.LaunchTime), 0.0f);
     }
 
     return TimeRemaining;
 }
 
+void AShooterGameGrenade::InitLaunch(const FVector& Origin, const FVector& Direction, float Strength, float LaunchTime, uint8 ThrowId, bool bInPredicted)
+{
+    LaunchInfo.Origin = Origin;
+    LaunchInfo.Direction = Direction;
+    LaunchInfo.Strength = Strength;
+    LaunchInfo.LaunchTime = LaunchTime;
+    LaunchInfo.ThrowId = ThrowId;
+    bPredicted = bInPredicted;
+}
+
+uint8 AShooterGameGrenade::GetThrowId() const
+{
+    return LaunchInfo.ThrowId;
+}
+
+void AShooterGameGrenade::Launch()
+{
+    SetActorLocationAndRotation(LaunchInfo.Origin, FRotator::ZeroRotator, false, nullptr, ETeleportType::ResetPhysics);
+
+    if (UPrimitiveComponent* RootPrimitiveComponent = Cast<UPrimitiveComponent>(GetRootComponent()))
+    {
+        // Start from rest, a grenade reused from the pool may still carry velocity
+        RootPrimitiveComponent->SetPhysicsLinearVelocity(FVector::ZeroVector);
+        RootPrimitiveComponent->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
+        RootPrimitiveComponent->AddImpulse(LaunchInfo.Direction * LaunchInfo.Strength);
+    }
+}
+
+void AShooterGameGrenade::LinkPredictedGrenade()
+{
+    if (PredictedGrenade.IsValid())
+    {
+        return;
+    }
+
+    AShooterCharacter* Thrower = Cast<AShooterCharacter>(GetInstigator());
+    if (Thrower && Thrower->IsLocallyControlled())
+    {
+        PredictedGrenade = Thrower->TakePredictedGrenade(LaunchInfo.ThrowId);
+        if (PredictedGrenade.IsValid())
+        {
+            DisableGrenade();
+        }
+    }
+}
+
+void AShooterGameGrenade::OnPredictionTimeout()
+{
+    // Server never confirmed the throw, remove the grenade without exploding
+    Destroy();
+}
+
+void AShooterGameGrenade::OnRep_LaunchInfo()
+{
+    // Initial launch is handled by BeginPlay, this is a grenade reused from the server's pool
+    if (!HasActorBegunPlay() || bPredicted || bDetonated)
+    {
+        return;
+    }
+
+    PredictedGrenade.Reset();
+    EnableGrenade();
+    StartClientLaunch();
+}
+
+void AShooterGameGrenade::OnRep_Detonated()
+{
+    if (!bDetonated)
+    {
+        return;
+    }
+
+    // Reconcile: the predicted copy is replaced by the explosion at the authoritative location
+    LinkPredictedGrenade();
+    if (AShooterGameGrenade* Predicted = PredictedGrenade.Get())
+    {
+        Predicted->Destroy();
+    }
+
+    SetActorLocation(DetonationLocation, false, nullptr, ETeleportType::TeleportPhysics);
+    DisableGrenade();
+    PlayDetonationEffects(DetonationLocation);
+}
+
+void AShooterGameGrenade::DisableGrenade()
+{
+    if (GrenadeStaticMeshComponent)
+    {
+        GrenadeStaticMeshComponent->SetSimulatePhysics(false);
+    }
+
+    SetActorEnableCollision(false);
+    SetActorHiddenInGame(true);
+}
+
+void AShooterGameGrenade::EnableGrenade()
+{
+    // Physics is set up on the blueprint's mesh, restore whatever it uses
+    const AShooterGameGrenade* DefaultGrenade = GetClass()->GetDefaultObject<AShooterGameGrenade>();
+    if (GrenadeStaticMeshComponent && DefaultGrenade->GrenadeStaticMeshComponent)
+    {
+        GrenadeStaticMeshComponent->SetSimulatePhysics(DefaultGrenade->GrenadeStaticMeshComponent->BodyInstance.bSimulatePhysics);
+    }
+
+    SetActorEnableCollision(true);
+    SetActorHiddenInGame(false);
+}
+
+float AShooterGameGrenade::GetServerWorldTime() const
+{
+    const AGameStateBase* GameState = GetWorld() ? GetWorld()->GetGameState() : nullptr;
+    return GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+}
+
 #if WITH_EDITOR
 void AShooterGameGrenade::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent)
 {
@@ -90,67 +299,47 @@ void AShooterGameGrenade::Detonate()
         return;
     }
 
-    TSet<AActor*> OverlappedActors;
-    ExplosionRadiusSphereComponent->GetOverlappingActors(OverlappedActors);
-
-    // Don't trace against self
-    FCollisionQueryParams CollisionQueryParams;
-    CollisionQueryParams.AddIgnoredActor(this);
-
-    for (AActor* OverlappedActor : OverlappedActors)
+    // Damage is dealt by the server, through the radial damage service shared with projectiles
+    AShooterGameMode* GameMode = GetWorld()->GetAuthGameMode<AShooterGameMode>();
+    if (GameMode)
     {
-        // Trace against the pawn to check if it was behind cover
-        TArray<FHitResult> HitResults;
-        GetWorld()->LineTraceMultiByChannel(
-            HitResults,
-            GetActorLocation(),
-            OverlappedActor->GetActorLocation(),
-            BlastTraceChannel,
-            CollisionQueryParams
-        );
-
-        bool bDamageBlocked = true; // Assume blocked initially
+        float MinRadius, MaxRadius;
+        DamageCurve->GetTimeRange(MinRadius, MaxRadius);
 
-        // Damage should not be blocked until we hit a non-Pawn actor AND
-        // if we never reached the overlapped actor. This will account for
-        // tracing past other pawns that we aren't interested in
-        for (FHitResult HitResult : HitResults)
-        {
-            if (HitResult.Actor != nullptr)
-            {
-                // If we reached the overlapped actor, then we can damage it
-                if (HitResult.Actor == OverlappedActor)
-                {
-                    bDamageBlocked = false;
-                }
-                // If the hitactor is not a pawn, then stop tracing
-                else if (!HitResult.Actor->IsA<APawn>())
-                {
-                    break;
-                }
-            }
-        }
+        FShooterRadialDamageParams DamageParams;
+        DamageParams.Origin = GetActorLocation();
+        DamageParams.Radius = MaxRadius;
+        DamageParams.DamageCurve = DamageCurve;
+        DamageParams.DamageCauser = this;
+        DamageParams.EventInstigator = GetInstigatorController();
+        DamageParams.OcclusionChannel = BlastTraceChannel;
 
-        if (bDamageBlocked == false)
-        {
-            const float DistanceToActor = FVector::Distance(GetActorLocation(), OverlappedActor->GetActorLocation());
-            const float DamageAmount = DamageCurve->GetFloatValue(DistanceToActor);
+        GameMode->GetRadialDamageService().ApplyRadialDamage(DamageParams);
+    }
 
-            FDamageEvent DamageEvent;
-            DamageEvent.DamageTypeClass = UDamageType::StaticClass();
+    bDetonated = true;
+    DetonationLocation = GetActorLocation();
 
-            // Finally deal damage to the target
-            OverlappedActor->TakeDamage(DamageAmount, DamageEvent, nullptr, nullptr);
-        }
+    if (GetNetMode() != NM_DedicatedServer)
+    {
+        PlayDetonationEffects(DetonationLocation);
     }
 
+    // Keep the actor around for a moment, so clients receive the detonation
+    DisableGrenade();
+    SetLifeSpan(2.0f);
+    ForceNetUpdate();
+}
+
+void AShooterGameGrenade::PlayDetonationEffects(const FVector& Location)
+{
     // Play one-shot VFX/SFX in level that is not bound to this actor so it can finish playing
     if (ExplosionSoundSettings.SoundCue)
     {
         UGameplayStatics::PlaySoundAtLocation(
             this,
             ExplosionSoundSettings.SoundCue,
-            GetActorLocation(),
+            Location,
             ExplosionSoundSettings.VolumeMultiplier,
             ExplosionSoundSettings.PitchMultiplier,
             0.0f,
@@ -161,13 +350,11 @@ void AShooterGameGrenade::Detonate()
         UNiagaraFunctionLibrary::SpawnSystemAtLocation(
             this,
             ExplosionVFX,
-            GetActorLocation(),
+            Location,
             FRotator::ZeroRotator,
             ExposionVFXScale
         );
     }
-
-    Destroy();
 }
 
 bool AShooterGameGrenade::GetDebugEnabled() const
@@ -0,0 +1,220 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Online/ShooterChatService.h"
+#include "Online/ShooterPlayerState.h"
+
+static int32 ShooterChatMaxLength = 128;
+FAutoConsoleVariableRef CVarShooterChatMaxLength(
+	TEXT("ShooterChat.MaxLength"),
+	ShooterChatMaxLength,
+	TEXT("Max characters of chat message, longer ones are truncated."),
+	ECVF_Default);
+
+static float ShooterChatRate = 1.0f;
+FAutoConsoleVariableRef CVarShooterChatRate(
+	TEXT("ShooterChat.Rate"),
+	ShooterChatRate,
+	TEXT("Chat messages per second each player may send in the long run."),
+	ECVF_Default);
+
+static int32 ShooterChatBurst = 4;
+FAutoConsoleVariableRef CVarShooterChatBurst(
+	TEXT("ShooterChat.Burst"),
+	ShooterChatBurst,
+	TEXT("Chat messages each player may send at once before rate limit applies."),
+	ECVF_Default);
+
+static int32 ShooterChatMaxNames = 64;
+FAutoConsoleVariableRef CVarShooterChatMaxNames(
+	TEXT("ShooterChat.MaxNames"),
+	ShooterChatMaxNames,
+	TEXT("Names interned per recipient, table starts over when it's full."),
+	ECVF_Default);
+
+FShooterChatService::FShooterChatService()
+{
+	ResetStats();
+}
+
+void FShooterChatService::Initialize(UWorld* InWorld)
+{
+	World = InWorld;
+}
+
+FShooterChatService* FShooterChatService::Get(const UObject* WorldContextObject)
+{
+	UWorld* MyWorld = WorldContextObject ? WorldContextObject->GetWorld() : NULL;
+	AShooterGameMode* GameMode = MyWorld ? MyWorld->GetAuthGameMode<AShooterGameMode>() : NULL;
+	return GameMode ? &GameMode->GetChatService() : NULL;
+}
+
+void FShooterChatService::ResetStats()
+{
+	NumSent = 0;
+	NumRateLimited = 0;
+	NumTruncated = 0;
+	NumBatches = 0;
+	NumNamesSent = 0;
+}
+
+bool FShooterChatService::Say(AShooterPlayerController* Sender, const FString& Msg, EShooterChatChannel::Type Channel)
+{
+	UWorld* MyWorld = World.Get();
+	AShooterPlayerState* SenderPlayerState = Sender ? Cast<AShooterPlayerState>(Sender->PlayerState) : NULL;
+	if (MyWorld == NULL || SenderPlayerState == NULL || Msg.IsEmpty())
+	{
+		return false;
+	}
+
+	// refill bucket for time since last message, then take one
+	const float Now = MyWorld->GetRealTimeSeconds();
+	const float MaxTokens = FMath::Max(ShooterChatBurst, 1);
+	FSenderState* SenderState = Senders.Find(SenderPlayerState->GetPlayerId());
+	if (SenderState == NULL)
+	{
+		SenderState = &Senders.Add(SenderPlayerState->GetPlayerId());
+		SenderState->Tokens = MaxTokens;
+	}
+	else
+	{
+		SenderState->Tokens = FMath::Min(SenderState->Tokens + (Now - SenderState->LastRefillTime) * ShooterChatRate, MaxTokens);
+	}
+	SenderState->LastRefillTime = Now;
+
+	if (SenderState->Tokens < 1.0f)
+	{
+		NumRateLimited++;
+		UE_LOG(LogShooter, Verbose, TEXT("Chat message of %s rate limited"), *SenderPlayerState->GetPlayerName());
+		return false;
+	}
+	SenderState->Tokens -= 1.0f;
+
+	AShooterGameState* const MyGameState = MyWorld->GetGameState<AShooterGameState>();
+	const bool bHasTeams = MyGameState && MyGameState->NumTeams > 1;
+
+	FMessage& Message = PendingMessages.AddDefaulted_GetRef();
+	Message.Sender = Sender;
+	Message.SenderName = SenderPlayerState->GetShortPlayerName();
+	Message.TeamNum = bHasTeams ? SenderPlayerState->GetTeamNum() : INDEX_NONE;
+	Message.Channel = Channel;
+	Message.Text = Msg.Left(FMath::Max(ShooterChatMaxLength, 1));
+
+	if (Message.Text.Len() < Msg.Len())
+	{
+		NumTruncated++;
+	}
+
+	return true;
+}
+
+int32 FShooterChatService::InternName(FRecipientState& Recipient, FShooterChatBatch& Batch, const FString& Name)
+{
+	const int32* NameIndex = Recipient.NameIndices.Find(Name);
+	if (NameIndex)
+	{
+		return *NameIndex;
+	}
+
+	// all lines of a batch refer to the same table, Tick sends lines before it starts over
+	if (WouldResetNames(Recipient, Name))
+	{
+		Recipient.NameIndices.Reset();
+		Batch.bResetNames = true;
+	}
+
+	NumNamesSent++;
+	Batch.NewNames.Add(Name);
+	return Recipient.NameIndices.Add(Name, Recipient.NameIndices.Num());
+}
+
+bool FShooterChatService::WouldResetNames(const FRecipientState& Recipient, const FString& Name) const
+{
+	return Recipient.NameIndices.Num() >= FMath::Max(ShooterChatMaxNames, 1) && !Recipient.NameIndices.Contains(Name);
+}
+
+void FShooterChatService::SendBatch(AShooterPlayerController* PC, FShooterChatBatch& Batch)
+{
+	if (Batch.Lines.Num() > 0)
+	{
+		PC->ClientReceiveChat(Batch);
+		NumBatches++;
+	}
+
+	Batch = FShooterChatBatch();
+}
+
+void FShooterChatService::Tick()
+{
+	UWorld* MyWorld = World.Get();
+	if (MyWorld == NULL || PendingMessages.Num() == 0)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ShooterChatService_Tick);
+
+	for (FConstPlayerControllerIterator It = MyWorld->GetPlayerControllerIterator(); It; ++It)
+	{
+		AShooterPlayerController* PC = Cast<AShooterPlayerController>(*It);
+		AShooterPlayerState* PlayerState = PC ? Cast<AShooterPlayerState>(PC->PlayerState) : NULL;
+		if (PlayerState == NULL)
+		{
+			continue;
+		}
+
+		FRecipientState& Recipient = Recipients.FindOrAdd(PC);
+		FShooterChatBatch Batch;
+
+		for (const FMessage& Message : PendingMessages)
+		{
+			// sender's chat widget already shows its own messages
+			if (Message.Sender == PC)
+			{
+				continue;
+			}
+
+			if (Message.Channel == EShooterChatChannel::Team && Message.TeamNum != INDEX_NONE && Message.TeamNum != PlayerState->GetTeamNum())
+			{
+				continue;
+			}
+
+			// table is full, send lines referring to it before starting over
+			if (Batch.Lines.Num() > 0 && WouldResetNames(Recipient, Message.SenderName))
+			{
+				SendBatch(PC, Batch);
+			}
+
+			const int32 NameIndex = InternName(Recipient, Batch, Message.SenderName);
+
+			FShooterChatLine& Line = Batch.Lines.AddDefaulted_GetRef();
+			Line.NameIndex = NameIndex;
+			Line.Channel = Message.Channel;
+			Line.Text = Message.Text;
+		}
+
+		SendBatch(PC, Batch);
+	}
+
+	NumSent += PendingMessages.Num();
+	PendingMessages.Reset();
+
+	// forget players which left and senders with full buckets
+	for (auto It = Recipients.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	const float Now = MyWorld->GetRealTimeSeconds();
+	const float RefillTime = ShooterChatRate > 0.0f ? FMath::Max(ShooterChatBurst, 1) / ShooterChatRate : MAX_flt;
+	for (auto It = Senders.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value().LastRefillTime > RefillTime)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,112 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Online/ShooterCombatLogCommandlet.h"
+#include "Online/ShooterCombatRecorder.h"
+
+UShooterCombatLogCommandlet::UShooterCombatLogCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UShooterCombatLogCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+	const FString FilePath = ParamVals.FindRef(TEXT("File"));
+	TArray<uint8> Data;
+	if (FilePath.IsEmpty() || !FFileHelper::LoadFileToArray(Data, *FilePath))
+	{
+		UE_LOG(LogShooter, Error, TEXT("Can't read combat log '%s', use -File=<path>"), *FilePath);
+		return 1;
+	}
+
+	FShooterCombatLogHeader Header;
+	TArray<FShooterCombatRecord> Records;
+	FString Error;
+	if (!FShooterCombatRecorder::ReadLog(Data, Header, Records, Error))
+	{
+		UE_LOG(LogShooter, Error, TEXT("%s: %s"), *FilePath, *Error);
+		return 1;
+	}
+
+	UE_LOG(LogShooter, Display, TEXT("%s: map %s, started %s UTC, version %d, %d events"),
+		*FilePath, ANSI_TO_TCHAR(Header.MapName), *FDateTime(Header.StartTime).ToString(), Header.Version, Records.Num());
+
+	struct FPlayerSummary
+	{
+		bool bBot;
+		int32 NumShots;
+		int32 NumHits;
+		int32 NumKills;
+		int32 NumDeaths;
+		int32 NumPickups;
+		float DamageDealt;
+		float DamageTaken;
+	};
+
+	TMap<int32, FPlayerSummary> Players;
+	auto FindPlayer = [&Players](int32 PlayerId) -> FPlayerSummary&
+	{
+		FPlayerSummary* Summary = Players.Find(PlayerId);
+		if (Summary == NULL)
+		{
+			Summary = &Players.Add(PlayerId);
+			FMemory::Memzero(*Summary);
+		}
+		return *Summary;
+	};
+
+	const bool bDump = Switches.Contains(TEXT("Dump"));
+	for (const FShooterCombatRecord& Record : Records)
+	{
+		if (bDump)
+		{
+			UE_LOG(LogShooter, Display, TEXT("%8.3f %-6s flags %d param %d instigator %d target %d value %.1f at (%.0f, %.0f, %.0f)"),
+				Record.Time, FShooterCombatRecorder::GetEventName(Record.Type), Record.Flags, Record.Param,
+				Record.InstigatorId, Record.TargetId, Record.Value, Record.X, Record.Y, Record.Z);
+		}
+
+		FPlayerSummary& Instigator = FindPlayer(Record.InstigatorId);
+		Instigator.bBot |= (Record.Flags & EShooterCombatEventFlags::Bot) != 0;
+
+		switch (Record.Type)
+		{
+			case EShooterCombatEvent::Shot:
+				Instigator.NumShots++;
+				break;
+			case EShooterCombatEvent::Hit:
+				Instigator.NumHits++;
+				Instigator.DamageDealt += Record.Value;
+				FindPlayer(Record.TargetId).DamageTaken += Record.Value;
+				break;
+			case EShooterCombatEvent::Kill:
+				Instigator.NumKills++;
+				FindPlayer(Record.TargetId).NumDeaths++;
+				break;
+			case EShooterCombatEvent::Pickup:
+				Instigator.NumPickups++;
+				break;
+			default:
+				break;
+		}
+	}
+
+	Players.KeySort(TLess<int32>());
+	for (const TPair<int32, FPlayerSummary>& Player : Players)
+	{
+		const FPlayerSummary& Summary = Player.Value;
+		UE_LOG(LogShooter, Display, TEXT("Player %d%s: %d shots, %d hits, %.0f damage dealt, %.0f taken, %d kills, %d deaths, %d pickups"),
+			Player.Key, Summary.bBot ? TEXT(" (bot)") : TEXT(""), Summary.NumShots, Summary.NumHits, Summary.DamageDealt, Summary.DamageTaken,
+			Summary.NumKills, Summary.NumDeaths, Summary.NumPickups);
+	}
+
+	return 0;
+}
@@ -0,0 +1,366 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Online/ShooterCombatRecorder.h"
+#include "HAL/RunnableThread.h"
+
+static int32 ShooterCombatLogEnable = 1;
+FAutoConsoleVariableRef CVarShooterCombatLogEnable(
+	TEXT("ShooterCombatLog.Enable"),
+	ShooterCombatLogEnable,
+	TEXT("Record shots, hits, kills and pickups of each match to Saved/CombatLogs, takes effect on next match.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+static float ShooterCombatLogFlushInterval = 0.5f;
+FAutoConsoleVariableRef CVarShooterCombatLogFlushInterval(
+	TEXT("ShooterCombatLog.FlushInterval"),
+	ShooterCombatLogFlushInterval,
+	TEXT("How often (s) recorded events are written to log, it's also done when a buffer is half full."),
+	ECVF_Default);
+
+static float ShooterCombatLogEventBudget = 250.0f;
+FAutoConsoleVariableRef CVarShooterCombatLogEventBudget(
+	TEXT("ShooterCombatLog.EventBudget"),
+	ShooterCombatLogEventBudget,
+	TEXT("Average time (ns) recording of event may take, exceeding it is reported at end of recording."),
+	ECVF_Default);
+
+FShooterCombatRecorder::FThreadBuffer::FThreadBuffer(uint32 InThreadId)
+	: ThreadId(InThreadId)
+	, Head(0)
+	, Tail(0)
+	, NumRecorded(0)
+	, NumDropped(0)
+	, RecordCycles(0)
+{
+}
+
+FShooterCombatRecorder::FShooterCombatRecorder()
+	: NumBuffers(0)
+	, NumDroppedWithoutBuffer(0)
+	, bReportedOutOfBuffers(false)
+	, LogFile(NULL)
+	, FlushThread(NULL)
+	, FlushEvent(FPlatformProcess::GetSynchEventFromPool(false))
+	, bStopFlushing(false)
+	, StartSeconds(0.0)
+	, NumBytesWritten(0)
+	, BaseNumRecorded(0)
+	, BaseNumDropped(0)
+	, BaseRecordCycles(0)
+{
+	FMemory::Memzero(Buffers);
+}
+
+FShooterCombatRecorder::~FShooterCombatRecorder()
+{
+	EndRecording();
+
+	for (int32 Idx = 0; Idx < NumBuffers.Load(); Idx++)
+	{
+		delete Buffers[Idx];
+	}
+
+	FPlatformProcess::ReturnSynchEventToPool(FlushEvent);
+}
+
+void FShooterCombatRecorder::Initialize(UWorld* InWorld)
+{
+	World = InWorld;
+}
+
+FShooterCombatRecorder* FShooterCombatRecorder::Get(const UObject* WorldContextObject)
+{
+	UWorld* MyWorld = WorldContextObject ? WorldContextObject->GetWorld() : NULL;
+	AShooterGameMode* GameMode = MyWorld ? MyWorld->GetAuthGameMode<AShooterGameMode>() : NULL;
+	return GameMode && GameMode->GetCombatRecorder().IsRecording() ? &GameMode->GetCombatRecorder() : NULL;
+}
+
+int32 FShooterCombatRecorder::GetPlayerId(const AController* Controller)
+{
+	return Controller && Controller->PlayerState ? Controller->PlayerState->GetPlayerId() : INDEX_NONE;
+}
+
+int32 FShooterCombatRecorder::GetPlayerId(const APawn* Pawn)
+{
+	const APlayerState* PlayerState = Pawn ? Pawn->GetPlayerState() : NULL;
+	return PlayerState ? PlayerState->GetPlayerId() : INDEX_NONE;
+}
+
+uint8 FShooterCombatRecorder::GetInstigatorFlags(const AController* Controller)
+{
+	return Controller && Controller->PlayerState && Controller->PlayerState->IsABot() ? EShooterCombatEventFlags::Bot : 0;
+}
+
+float FShooterCombatRecorder::GetEventBudget()
+{
+	return ShooterCombatLogEventBudget;
+}
+
+const TCHAR* FShooterCombatRecorder::GetEventName(uint8 Type)
+{
+	static const TCHAR* Names[EShooterCombatEvent::MAX] = { TEXT("Shot"), TEXT("Hit"), TEXT("Kill"), TEXT("Pickup") };
+	return Type < EShooterCombatEvent::MAX ? Names[Type] : TEXT("Unknown");
+}
+
+void FShooterCombatRecorder::BeginRecording()
+{
+	EndRecording();
+
+	UWorld* MyWorld = World.Get();
+	if (ShooterCombatLogEnable <= 0 || MyWorld == NULL)
+	{
+		return;
+	}
+
+	const FString MapName = UWorld::RemovePIEPrefix(FPackageName::GetShortName(MyWorld->GetOutermost()->GetName()));
+	const FDateTime StartTime = FDateTime::UtcNow();
+	LogPath = FPaths::ProjectSavedDir() / TEXT("CombatLogs") / FString::Printf(TEXT("%s_%s.sclog"), *MapName, *StartTime.ToString());
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(LogPath));
+	LogFile = PlatformFile.OpenWrite(*LogPath);
+	if (LogFile == NULL)
+	{
+		UE_LOG(LogShooter, Warning, TEXT("Failed to open combat log %s"), *LogPath);
+		return;
+	}
+
+	FShooterCombatLogHeader Header;
+	FMemory::Memzero(Header);
+	Header.Magic = FShooterCombatLogHeader::LogMagic;
+	Header.Version = FShooterCombatLogHeader::LogVersion;
+	Header.RecordSize = sizeof(FShooterCombatRecord);
+	Header.StartTime = StartTime.GetTicks();
+	FCStringAnsi::Strncpy(Header.MapName, TCHAR_TO_ANSI(*MapName), UE_ARRAY_COUNT(Header.MapName));
+	LogFile->Write((const uint8*)&Header, sizeof(Header));
+
+	// buffers outlive recordings, remember where their counters were
+	BaseNumRecorded = 0;
+	BaseNumDropped = NumDroppedWithoutBuffer.Load();
+	BaseRecordCycles = 0;
+	for (int32 Idx = 0; Idx < NumBuffers.Load(); Idx++)
+	{
+		BaseNumRecorded += Buffers[Idx]->NumRecorded.Load();
+		BaseNumDropped += Buffers[Idx]->NumDropped.Load();
+		BaseRecordCycles += Buffers[Idx]->RecordCycles.Load();
+	}
+	NumBytesWritten = sizeof(Header);
+	StartSeconds = FPlatformTime::Seconds();
+
+	// register game thread buffer now, so recording events never allocates there
+	GetThreadBuffer();
+	FlushRecords.Reserve(BufferSize);
+
+	bStopFlushing = false;
+	FlushThread = FRunnableThread::Create(this, TEXT("ShooterCombatRecorder"), 0, TPri_BelowNormal);
+}
+
+void FShooterCombatRecorder::EndRecording()
+{
+	if (FlushThread)
+	{
+		// flush thread writes remaining events before exiting
+		FlushThread->Kill(true);
+		delete FlushThread;
+		FlushThread = NULL;
+	}
+
+	if (LogFile)
+	{
+		delete LogFile;
+		LogFile = NULL;
+
+		const FStats Stats = GetStats();
+		UE_LOG(LogShooter, Log, TEXT("Combat log %s: %d events, %d dropped, %lld bytes, %.0f ns per event"),
+			*LogPath, Stats.NumRecorded, Stats.NumDropped, Stats.NumBytesWritten, Stats.AverageRecordTime);
+
+		if (Stats.AverageRecordTime > ShooterCombatLogEventBudget)
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Combat log recording took %.0f ns per event, over budget of %.0f ns"), Stats.AverageRecordTime, ShooterCombatLogEventBudget);
+		}
+	}
+}
+
+FShooterCombatRecorder::FThreadBuffer* FShooterCombatRecorder::GetThreadBuffer()
+{
+	const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+
+	const int32 NumRegistered = NumBuffers.Load();
+	for (int32 Idx = 0; Idx < NumRegistered; Idx++)
+	{
+		if (Buffers[Idx]->ThreadId == ThreadId)
+		{
+			return Buffers[Idx];
+		}
+	}
+
+	// first event of this thread, other threads may be registering too
+	FScopeLock Lock(&BuffersCriticalSection);
+
+	const int32 NewIdx = NumBuffers.Load();
+	if (NewIdx >= MaxBuffers)
+	{
+		return NULL;
+	}
+
+	Buffers[NewIdx] = new FThreadBuffer(ThreadId);
+	NumBuffers.Store(NewIdx + 1);
+
+	return Buffers[NewIdx];
+}
+
+void FShooterCombatRecorder::Record(EShooterCombatEvent::Type Type, uint8 Flags, uint16 Param, int32 InstigatorId, int32 TargetId, float Value, const FVector& Location)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	FThreadBuffer* Buffer = GetThreadBuffer();
+	if (Buffer == NULL)
+	{
+		NumDroppedWithoutBuffer.IncrementExchange();
+		if (!bReportedOutOfBuffers.Exchange(true))
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Combat recorder is out of thread buffers (%d), events of further threads are dropped"), (int32)MaxBuffers);
+		}
+		return;
+	}
+
+	const uint32 Head = Buffer->Head.Load(EMemoryOrder::Relaxed);
+	const uint32 NumPending = Head - Buffer->Tail.Load();
+	if (NumPending >= BufferSize)
+	{
+		Buffer->NumDropped.Store(Buffer->NumDropped.Load(EMemoryOrder::Relaxed) + 1, EMemoryOrder::Relaxed);
+		FlushEvent->Trigger();
+		return;
+	}
+
+	FShooterCombatRecord& NewRecord = Buffer->Records[Head & (BufferSize - 1)];
+	NewRecord.Time = (float)(FPlatformTime::Seconds() - StartSeconds);
+	NewRecord.Type = (uint8)Type;
+	NewRecord.Flags = Flags;
+	NewRecord.Param = Param;
+	NewRecord.InstigatorId = InstigatorId;
+	NewRecord.TargetId = TargetId;
+	NewRecord.Value = Value;
+	NewRecord.X = Location.X;
+	NewRecord.Y = Location.Y;
+	NewRecord.Z = Location.Z;
+
+	// publish record to flush thread
+	Buffer->Head.Store(Head + 1);
+
+	if (NumPending + 1 == BufferSize / 2)
+	{
+		FlushEvent->Trigger();
+	}
+
+	Buffer->NumRecorded.Store(Buffer->NumRecorded.Load(EMemoryOrder::Relaxed) + 1, EMemoryOrder::Relaxed);
+	Buffer->RecordCycles.Store(Buffer->RecordCycles.Load(EMemoryOrder::Relaxed) + (FPlatformTime::Cycles64() - StartCycles), EMemoryOrder::Relaxed);
+}
+
+uint32 FShooterCombatRecorder::Run()
+{
+	while (!bStopFlushing.Load())
+	{
+		FlushEvent->Wait(FMath::Max(FMath::TruncToInt(ShooterCombatLogFlushInterval * 1000.0f), 1));
+		FlushBuffers();
+	}
+
+	FlushBuffers();
+	return 0;
+}
+
+void FShooterCombatRecorder::Stop()
+{
+	bStopFlushing = true;
+	FlushEvent->Trigger();
+}
+
+void FShooterCombatRecorder::FlushBuffers()
+{
+	const int32 NumRegistered = NumBuffers.Load();
+	for (int32 Idx = 0; Idx < NumRegistered; Idx++)
+	{
+		FThreadBuffer* Buffer = Buffers[Idx];
+		const uint32 Tail = Buffer->Tail.Load(EMemoryOrder::Relaxed);
+		const uint32 Head = Buffer->Head.Load();
+		for (uint32 RecordIdx = Tail; RecordIdx != Head; RecordIdx++)
+		{
+			FlushRecords.Add(Buffer->Records[RecordIdx & (BufferSize - 1)]);
+		}
+
+		// hand slots back to owning thread
+		Buffer->Tail.Store(Head);
+	}
+
+	if (FlushRecords.Num() > 0 && LogFile)
+	{
+		const int64 NumBytes = FlushRecords.Num() * sizeof(FShooterCombatRecord);
+		LogFile->Write((const uint8*)FlushRecords.GetData(), NumBytes);
+		LogFile->Flush();
+		NumBytesWritten = NumBytesWritten.Load() + NumBytes;
+	}
+
+	FlushRecords.Reset();
+}
+
+FShooterCombatRecorder::FStats FShooterCombatRecorder::GetStats() const
+{
+	uint32 NumRecorded = 0;
+	uint32 NumDropped = NumDroppedWithoutBuffer.Load(EMemoryOrder::Relaxed);
+	uint64 RecordCycles = 0;
+	for (int32 Idx = 0; Idx < NumBuffers.Load(); Idx++)
+	{
+		NumRecorded += Buffers[Idx]->NumRecorded.Load(EMemoryOrder::Relaxed);
+		NumDropped += Buffers[Idx]->NumDropped.Load(EMemoryOrder::Relaxed);
+		RecordCycles += Buffers[Idx]->RecordCycles.Load(EMemoryOrder::Relaxed);
+	}
+
+	FStats Stats;
+	Stats.NumRecorded = NumRecorded - BaseNumRecorded;
+	Stats.NumDropped = NumDropped - BaseNumDropped;
+	Stats.NumBytesWritten = NumBytesWritten.Load();
+	Stats.AverageRecordTime = Stats.NumRecorded > 0 ? FPlatformTime::ToSeconds64(RecordCycles - BaseRecordCycles) * 1000000000.0 / Stats.NumRecorded : 0.0;
+
+	return Stats;
+}
+
+bool FShooterCombatRecorder::ReadLog(const TArray<uint8>& Data, FShooterCombatLogHeader& OutHeader, TArray<FShooterCombatRecord>& OutRecords, FString& OutError)
+{
+	OutRecords.Reset();
+
+	if (Data.Num() < (int32)sizeof(FShooterCombatLogHeader))
+	{
+		OutError = TEXT("File is too short");
+		return false;
+	}
+
+	FMemory::Memcpy(&OutHeader, Data.GetData(), sizeof(FShooterCombatLogHeader));
+	OutHeader.MapName[UE_ARRAY_COUNT(OutHeader.MapName) - 1] = 0;
+
+	if (OutHeader.Magic != FShooterCombatLogHeader::LogMagic)
+	{
+		OutError = TEXT("Not a combat log");
+		return false;
+	}
+
+	if (OutHeader.Version != FShooterCombatLogHeader::LogVersion || OutHeader.RecordSize != sizeof(FShooterCombatRecord))
+	{
+		OutError = FString::Printf(TEXT("Unsupported log version %d with record size %d"), OutHeader.Version, OutHeader.RecordSize);
+		return false;
+	}
+
+	// partial record at the end is left by crashed server
+	const int32 NumRecords = (Data.Num() - sizeof(FShooterCombatLogHeader)) / sizeof(FShooterCombatRecord);
+	OutRecords.SetNumUninitialized(NumRecords);
+	FMemory::Memcpy(OutRecords.GetData(), Data.GetData() + sizeof(FShooterCombatLogHeader), NumRecords * sizeof(FShooterCombatRecord));
+
+	// buffers of different threads are flushed one after another
+	OutRecords.StableSort([](const FShooterCombatRecord& A, const FShooterCombatRecord& B)
+	{
+		return A.Time < B.Time;
+	});
+
+	return true;
+}
@@ -11,6 +11,8 @@
 #include "Bots/ShooterAIController.h"
 #include "ShooterTeamStart.h"
 
+DECLARE_CYCLE_STAT(TEXT("Choose Player Start"), STAT_ShooterChoosePlayerStart, STATGROUP_ShooterGame);
+DECLARE_CYCLE_STAT(TEXT("Rate Spawn Point"), STAT_ShooterRateSpawnpoint, STATGROUP_ShooterGame);
 
 AShooterGameMode::AShooterGameMode(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
@@ -31,6 +33,18 @@ AShooterGameMode::AShooterGameMode(const FObjectInitializer& ObjectInitializer)
 
 	bAllowBots = true;	
 	bNeedsBotCreation = true;
+	BotSpawnsPerFrame = 1;
+	BotSpawnBudgetMs = 0.0f;
+	SpawnThreatRadius = 2500.0f;
+	SpawnInfluenceWeight = 0.05f;
+	PIESpawnPoint = NULL;
+	bSpawnPointsCached = false;
+	NumPendingBotCreations = 0;
+	NextBotNum = 0;
+	BotQueueFrames = 0;
+	BotQueueProcessed = 0;
+	BotQueueWorstFrameMs = 0.0;
+	PrimaryActorTick.bCanEverTick = true;
 	bUseSeamlessTravel = FParse::Param(FCommandLine::Get(), TEXT("NoSeamlessTravel")) ? false : true;
 }
 
@@ -78,6 +92,35 @@ void AShooterGameMode::PreInitializeComponents()
 	Super::PreInitializeComponents();
 
 	GetWorldTimerManager().SetTimer(TimerHandle_DefaultTimer, this, &AShooterGameMode::DefaultTimer, GetWorldSettings()->GetEffectiveTimeDilation(), true);
+
+	BotPathQueue.Initialize(GetWorld());
+	TeamInfluenceMap.Initialize(GetWorld());
+	RadialDamageService.Initialize(GetWorld());
+	ProjectilePool.Initialize(GetWorld());
+	CombatRecorder.Initialize(GetWorld());
+	ChatService.Initialize(GetWorld());
+	ServerMetrics.Initialize(GetWorld());
+	TickRateGovernor.Initialize(GetWorld());
+}
+
+void AShooterGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	CombatRecorder.EndRecording();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AShooterGameMode::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	ProcessBotQueue();
+	BotPathQueue.Tick();
+	TeamInfluenceMap.Tick(DeltaSeconds);
+	RadialDamageService.Tick();
+	ChatService.Tick();
+	ServerMetrics.Tick();
+	TickRateGovernor.Tick();
 }
 
 void AShooterGameMode::DefaultTimer()
@@ -97,6 +140,7 @@ void AShooterGameMode::DefaultTimer()
 	if (MyGameState && MyGameState->RemainingTime > 0 && !MyGameState->bTimerPaused)
 	{
 		MyGameState->RemainingTime--;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterGameState, RemainingTime, MyGameState);
 		
 		if (MyGameState->RemainingTime <= 0)
 		{
@@ -117,8 +161,16 @@ void AShooterGameMode::DefaultTimer()
 					{
 						AShooterPlayerState* PlayerState = Cast<AShooterPlayerState>((*It)->PlayerState);
 						const bool bIsWinner = IsWinner(PlayerState);
-					
-						PlayerController->ClientSendRoundEndEvent(bIsWinner, MyGameState->ElapsedTime);
+						const int32 ElapsedTime = MyGameState->ElapsedTime;
+						TWeakObjectPtr<AShooterPlayerController> WeakPC = PlayerController;
+
+						FShooterMatchEndPipeline::QueueJob(this, TEXT("RoundEndEvent"), [WeakPC, bIsWinner, ElapsedTime]()
+						{
+							if (AShooterPlayerController* PC = WeakPC.Get())
+							{
+								PC->ClientSendRoundEndEvent(bIsWinner, ElapsedTime);
+							}
+						});
 					}
 				}
 			}
@@ -155,6 +207,7 @@ void AShooterGameMode::HandleMatchIsWaitingToStart()
 			{
 				MyGameState->RemainingTime = 0.0f;
 			}
+			MARK_PROPERTY_DIRTY_FROM_NAME(AShooterGameState, RemainingTime, MyGameState);
 		}
 	}
 }
@@ -166,6 +219,9 @@ void AShooterGameMode::HandleMatchHasStarted()
 
 	AShooterGameState* const MyGameState = Cast<AShooterGameState>(GameState);
 	MyGameState->RemainingTime = RoundTime;	
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterGameState, RemainingTime, MyGameState);
+	TeamInfluenceMap.Reset();
+	CombatRecorder.BeginRecording();
 	StartBots();	
 
 	// notify players
@@ -192,25 +248,54 @@ void AShooterGameMode::FinishMatch()
 		EndMatch();
 		DetermineMatchWinner();		
 
-		// notify players
-		for (FConstControllerIterator It = GetWorld()->GetControllerIterator(); It; ++It)
+		// closing log waits for flush thread
+		TWeakObjectPtr<AShooterGameMode> WeakThis = this;
+		FShooterMatchEndPipeline::QueueJob(this, TEXT("CombatLog"), [WeakThis]()
 		{
-			AShooterPlayerState* PlayerState = Cast<AShooterPlayerState>((*It)->PlayerState);
-			const bool bIsWinner = IsWinner(PlayerState);
-
-			(*It)->GameHasEnded(NULL, bIsWinner);
-		}
+			if (WeakThis.IsValid())
+			{
+				WeakThis->CombatRecorder.EndRecording();
+			}
+		});
 
 		// lock all pawns
+		// done by match end pipeline along with notifying players, spread over next frames instead of this one.
 		// pawns are not marked as keep for seamless travel, so we will create new pawns on the next match rather than
 		// turning these back on.
 		for (APawn* Pawn : TActorRange<APawn>(GetWorld()))
 		{
-			Pawn->TurnOff();
+			TWeakObjectPtr<APawn> WeakPawn = Pawn;
+			FShooterMatchEndPipeline::QueueJob(this, TEXT("TurnOffPawn"), [WeakPawn]()
+			{
+				if (APawn* MyPawn = WeakPawn.Get())
+				{
+					MyPawn->TurnOff();
+				}
+			});
+		}
+
+		// notify players
+		for (FConstControllerIterator It = GetWorld()->GetControllerIterator(); It; ++It)
+		{
+			AShooterPlayerState* PlayerState = Cast<AShooterPlayerState>((*It)->PlayerState);
+			const bool bIsWinner = IsWinner(PlayerState);
+			TWeakObjectPtr<AController> WeakController = It->Get();
+
+			FShooterMatchEndPipeline::QueueJob(this, TEXT("GameHasEnded"), [WeakController, bIsWinner]()
+			{
+				if (AController* Controller = WeakController.Get())
+				{
+					Controller->GameHasEnded(NULL, bIsWinner);
+				}
+			});
 		}
 
+		// bots still waiting for first spawn stay dead
+		PendingBotSpawns.Empty();
+
 		// set up to restart the match
 		MyGameState->RemainingTime = TimeBetweenMatches;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterGameState, RemainingTime, MyGameState);
 	}
 }
 
@@ -218,6 +303,13 @@ void AShooterGameMode::RequestFinishAndExitToMainMenu()
 {
 	FinishMatch();
 
+	// players have to be told about match end before being sent back to menu
+	FShooterMatchEndPipeline* MatchEndPipeline = FShooterMatchEndPipeline::Get(this);
+	if (MatchEndPipeline)
+	{
+		MatchEndPipeline->Flush();
+	}
+
 	UShooterGameInstance* const GameInstance = Cast<UShooterGameInstance>(GetGameInstance());
 	if (GameInstance)
 	{
@@ -302,16 +394,27 @@ void AShooterGameMode::Killed(AController* Killer, AController* KilledPlayer, AP
 	AShooterPlayerState* KillerPlayerState = Killer ? Cast<AShooterPlayerState>(Killer->PlayerState) : NULL;
 	AShooterPlayerState* VictimPlayerState = KilledPlayer ? Cast<AShooterPlayerState>(KilledPlayer->PlayerState) : NULL;
 
+	FShooterCombatRecorder* CombatRecorder = FShooterCombatRecorder::Get(this);
+	if (CombatRecorder && KilledPawn)
+	{
+		CombatRecorder->Record(EShooterCombatEvent::Kill, FShooterCombatRecorder::GetInstigatorFlags(Killer), 0,
+			FShooterCombatRecorder::GetPlayerId(Killer), FShooterCombatRecorder::GetPlayerId(KilledPlayer), 0.0f, KilledPawn->GetActorLocation());
+	}
+
 	if (KillerPlayerState && KillerPlayerState != VictimPlayerState)
 	{
 		KillerPlayerState->ScoreKill(VictimPlayerState, KillScore);
-		KillerPlayerState->InformAboutKill(KillerPlayerState, DamageType, VictimPlayerState);
 	}
 
 	if (VictimPlayerState)
 	{
 		VictimPlayerState->ScoreDeath(KillerPlayerState, DeathScore);
-		VictimPlayerState->BroadcastDeath(KillerPlayerState, DamageType, VictimPlayerState);
+
+		AShooterGameState* const MyGameState = GetGameState<AShooterGameState>();
+		if (MyGameState)
+		{
+			MyGameState->AddKillFeedEntry(KillerPlayerState, VictimPlayerState, DamageType);
+		}
 	}
 }
 
@@ -370,6 +473,9 @@ void AShooterGameMode::RestartPlayer(AController* NewPlayer)
 {
 	Super::RestartPlayer(NewPlayer);
 
+	// spawn points rated later this frame must see the new pawn
+	PawnOccupancyGrid.AddSpawnedPawn(NewPlayer ? Cast<ACharacter>(NewPlayer->GetPawn()) : NULL);
+
 	AShooterPlayerController* PC = Cast<AShooterPlayerController>(NewPlayer);
 	if (PC)
 	{
@@ -386,49 +492,93 @@ void AShooterGameMode::RestartPlayer(AController* NewPlayer)
 
 AActor* AShooterGameMode::ChoosePlayerStart_Implementation(AController* Player)
 {
-	TArray<APlayerStart*> PreferredSpawns;
-	TArray<APlayerStart*> FallbackSpawns;
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterChoosePlayerStart, ShooterCharacters, ChoosePlayerStart);
+
+	if (!bSpawnPointsCached)
+	{
+		CacheSpawnPoints();
+	}
+
+	// Always prefer the first "Play from Here" PlayerStart, if we find one while in PIE mode
+	if (PIESpawnPoint)
+	{
+		return PIESpawnPoint;
+	}
 
 	APlayerStart* BestStart = NULL;
-	for (TActorIterator<APlayerStart> It(GetWorld()); It; ++It)
+	float BestRating = -MAX_FLT;
+	bool bBestBlocked = true;
+	for (int32 SpawnIdx : GetAllowedSpawnPoints(Player))
 	{
-		APlayerStart* TestSpawn = *It;
-		if (TestSpawn->IsA<APlayerStartPIE>())
+		APlayerStart* TestSpawn = SpawnPoints[SpawnIdx];
+		if (TestSpawn == NULL)
 		{
-			// Always prefer the first "Play from Here" PlayerStart, if we find one while in PIE mode
-			BestStart = TestSpawn;
-			break;
+			continue;
 		}
-		else
+
+		bool bBlocked = false;
+		const float Rating = RateSpawnpoint(TestSpawn, Player, bBlocked);
+
+		// free spawns always win over blocked ones
+		if (BestStart == NULL || (bBestBlocked && !bBlocked) || (bBestBlocked == bBlocked && Rating > BestRating))
 		{
-			if (IsSpawnpointAllowed(TestSpawn, Player))
-			{
-				if (IsSpawnpointPreferred(TestSpawn, Player))
-				{
-					PreferredSpawns.Add(TestSpawn);
-				}
-				else
-				{
-					FallbackSpawns.Add(TestSpawn);
-				}
-			}
+			BestStart = TestSpawn;
+			BestRating = Rating;
+			bBestBlocked = bBlocked;
 		}
 	}
 
-	
-	if (BestStart == NULL)
+	return BestStart ? BestStart : Super::ChoosePlayerStart_Implementation(Player);
+}
+
+void AShooterGameMode::CacheSpawnPoints()
+{
+	bSpawnPointsCached = true;
+	SpawnPoints.Reset();
+	AllowedSpawnPoints.Reset();
+	PIESpawnPoint = NULL;
+
+	for (TActorIterator<APlayerStart> It(GetWorld()); It; ++It)
 	{
-		if (PreferredSpawns.Num() > 0)
+		APlayerStart* TestSpawn = *It;
+		if (TestSpawn->IsA<APlayerStartPIE>())
 		{
-			BestStart = PreferredSpawns[FMath::RandHelper(PreferredSpawns.Num())];
+			PIESpawnPoint = TestSpawn;
+			break;
 		}
-		else if (FallbackSpawns.Num() > 0)
+
+		SpawnPoints.Add(TestSpawn);
+	}
+}
+
+int32 AShooterGameMode::GetSpawnPointsKey(AController* Player) const
+{
+	AShooterPlayerState* PlayerState = Player ? Cast<AShooterPlayerState>(Player->PlayerState) : NULL;
+	const int32 TeamNum = PlayerState ? PlayerState->GetTeamNum() : 0;
+	const bool bIsBot = Cast<AShooterAIController>(Player) != NULL;
+
+	return TeamNum * 2 + (bIsBot ? 1 : 0);
+}
+
+const TArray<int32>& AShooterGameMode::GetAllowedSpawnPoints(AController* Player)
+{
+	const int32 Key = GetSpawnPointsKey(Player);
+	if (const TArray<int32>* Cached = AllowedSpawnPoints.Find(Key))
+	{
+		return *Cached;
+	}
+
+	// spawn point rules depend only on team and bot flag, so the first player of that kind decides for everyone
+	TArray<int32>& Allowed = AllowedSpawnPoints.Add(Key);
+	for (int32 SpawnIdx = 0; SpawnIdx < SpawnPoints.Num(); SpawnIdx++)
+	{
+		if (SpawnPoints[SpawnIdx] && IsSpawnpointAllowed(SpawnPoints[SpawnIdx], Player))
 		{
-			BestStart = FallbackSpawns[FMath::RandHelper(FallbackSpawns.Num())];
+			Allowed.Add(SpawnIdx);
 		}
 	}
 
-	return BestStart ? BestStart : Super::ChoosePlayerStart_Implementation(Player);
+	return Allowed;
 }
 
 bool AShooterGameMode::IsSpawnpointAllowed(APlayerStart* SpawnPoint, AController* Player) const
@@ -454,38 +604,76 @@ bool AShooterGameMode::IsSpawnpointAllowed(APlayerStart* SpawnPoint, AController
 
 bool AShooterGameMode::IsSpawnpointPreferred(APlayerStart* SpawnPoint, AController* Player) const
 {
+	bool bBlocked = false;
+	RateSpawnpoint(SpawnPoint, Player, bBlocked);
+
+	return !bBlocked;
+}
+
+float AShooterGameMode::RateSpawnpoint(APlayerStart* SpawnPoint, AController* Player, bool& bOutBlocked) const
+{
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterRateSpawnpoint, ShooterCharacters, RateSpawnpoint);
+
 	ACharacter* MyPawn = Cast<ACharacter>((*DefaultPawnClass)->GetDefaultObject<ACharacter>());	
 	AShooterAIController* AIController = Cast<AShooterAIController>(Player);
 	if( AIController != nullptr )
 	{
 		MyPawn = Cast<ACharacter>(BotPawnClass->GetDefaultObject<ACharacter>());
 	}
-	
-	if (MyPawn)
+
+	bOutBlocked = true;
+	if (MyPawn == NULL)
 	{
-		const FVector SpawnLocation = SpawnPoint->GetActorLocation();
-		for (ACharacter* OtherPawn : TActorRange<ACharacter>(GetWorld()))
+		return -MAX_FLT;
+	}
+
+	// occupancy grid is rebuilt once per frame, make sure it's there for callers outside of ChoosePlayerStart
+	PawnOccupancyGrid.Update(GetWorld());
+
+	AShooterPlayerState* MyPlayerState = Player ? Cast<AShooterPlayerState>(Player->PlayerState) : NULL;
+	const float MyRadius = MyPawn->GetCapsuleComponent()->GetScaledCapsuleRadius();
+	const float MyHalfHeight = MyPawn->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	const FVector SpawnLocation = SpawnPoint->GetActorLocation();
+
+	bOutBlocked = false;
+	float Threat = 0.0f;
+
+	// grid entries are registered by center, pad the query with a generous capsule radius
+	PawnOccupancyGrid.ForEachPawnNear(SpawnLocation, SpawnThreatRadius + MyRadius * 4.0f, [&](const FShooterPawnOccupancyGrid::FEntry& Other)
+	{
+		const float CombinedHeight = (MyHalfHeight + Other.HalfHeight) * 2.0f;
+		const float CombinedRadius = MyRadius + Other.Radius;
+		const float Dist2D = (SpawnLocation - Other.Location).Size2D();
+
+		// check if player start overlaps this pawn
+		if (FMath::Abs(SpawnLocation.Z - Other.Location.Z) < CombinedHeight && Dist2D < CombinedRadius)
 		{
-			if (OtherPawn != MyPawn)
-			{
-				const float CombinedHeight = (MyPawn->GetCapsuleComponent()->GetScaledCapsuleHalfHeight() + OtherPawn->GetCapsuleComponent()->GetScaledCapsuleHalfHeight()) * 2.0f;
-				const float CombinedRadius = MyPawn->GetCapsuleComponent()->GetScaledCapsuleRadius() + OtherPawn->GetCapsuleComponent()->GetScaledCapsuleRadius();
-				const FVector OtherLocation = OtherPawn->GetActorLocation();
+			bOutBlocked = true;
+		}
 
-				// check if player start overlaps this pawn
-				if (FMath::Abs(SpawnLocation.Z - OtherLocation.Z) < CombinedHeight && (SpawnLocation - OtherLocation).Size2D() < CombinedRadius)
-				{
-					return false;
-				}
+		const bool bIsEnemy = Other.bAlive && Other.PlayerState != MyPlayerState &&
+			(MyPlayerState == NULL || Other.PlayerState == NULL || CanDealDamage(Other.PlayerState, MyPlayerState));
+
+		if (bIsEnemy && Dist2D < SpawnThreatRadius)
+		{
+			float PawnThreat = 1.0f - Dist2D / SpawnThreatRadius;
+
+			// enemies looking at spawn point are worse
+			const FVector ToSpawn = (SpawnLocation - Other.Location).GetSafeNormal();
+			if ((ToSpawn | Other.ViewDirection) > 0.5f)
+			{
+				PawnThreat *= 2.0f;
 			}
+
+			Threat += PawnThreat;
 		}
-	}
-	else
-	{
-		return false;
-	}
-	
-	return true;
+	});
+
+	// influence map adds where enemies were recently and where fights are going on
+	Threat += TeamInfluenceMap.GetEnemyInfluence(SpawnLocation, MyPlayerState ? MyPlayerState->GetTeamNum() : 0, MyPlayerState) * SpawnInfluenceWeight;
+
+	// small random part keeps picks varied between equally safe spawns
+	return -Threat + FMath::FRand() * 0.1f;
 }
 
 void AShooterGameMode::CreateBotControllers()
@@ -501,16 +689,15 @@ void AShooterGameMode::CreateBotControllers()
 		}
 	}
 
-	// Create any necessary AIControllers.  Hold off on Pawn creation until pawns are actually necessary or need recreating.	
-	int32 BotNum = ExistingBots;
-	for (int32 i = 0; i < MaxBots - ExistingBots; ++i)
-	{
-		CreateBot(BotNum + i);
-	}
+	// Queue any necessary AIControllers, they are created over the next frames.  Hold off on Pawn creation until pawns are actually necessary or need recreating.	
+	NextBotNum = ExistingBots;
+	NumPendingBotCreations = FMath::Max(MaxBots - ExistingBots, 0);
 }
 
 AShooterAIController* AShooterGameMode::CreateBot(int32 BotNum)
 {
+	SHOOTER_LLM_SCOPE(Bots);
+
 	FActorSpawnParameters SpawnInfo;
 	SpawnInfo.Instigator = nullptr;
 	SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
@@ -527,14 +714,92 @@ void AShooterGameMode::StartBots()
 {
 	// checking number of existing human player.
 	UWorld* World = GetWorld();
+	TArray<AShooterAIController*> Bots;
+	TMap<int32, int32> BotsPerTeam;
+	TMap<const AShooterAIController*, int32> RankInTeam;
 	for (FConstControllerIterator It = World->GetControllerIterator(); It; ++It)
 	{		
 		AShooterAIController* AIC = Cast<AShooterAIController>(*It);
 		if (AIC)
 		{
-			RestartPlayer(AIC);
+			AShooterPlayerState* PlayerState = Cast<AShooterPlayerState>(AIC->PlayerState);
+			const int32 TeamNum = PlayerState ? PlayerState->GetTeamNum() : 0;
+			RankInTeam.Add(AIC, BotsPerTeam.FindOrAdd(TeamNum)++);
+			Bots.Add(AIC);
 		}
 	}	
+
+	// interleave teams, so teams are balanced at any point of the staggered spawn
+	Bots.StableSort([&RankInTeam](const AShooterAIController& A, const AShooterAIController& B)
+	{
+		return RankInTeam[&A] < RankInTeam[&B];
+	});
+
+	for (AShooterAIController* AIC : Bots)
+	{
+		PendingBotSpawns.Add(AIC);
+	}
+}
+
+void AShooterGameMode::ProcessBotQueue()
+{
+	if (NumPendingBotCreations == 0 && PendingBotSpawns.Num() == 0)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ShooterGameMode_ProcessBotQueue);
+
+	const double StartTime = FPlatformTime::Seconds();
+	int32 NumProcessed = 0;
+
+	// always make progress, even if a single bot is over the time budget
+	auto HasBudget = [&]()
+	{
+		const bool bCountBudget = BotSpawnsPerFrame <= 0 || NumProcessed < BotSpawnsPerFrame;
+		const bool bTimeBudget = BotSpawnBudgetMs <= 0.0f || NumProcessed == 0 || (FPlatformTime::Seconds() - StartTime) * 1000.0 < BotSpawnBudgetMs;
+		return bCountBudget && bTimeBudget;
+	};
+
+	while (NumPendingBotCreations > 0 && HasBudget())
+	{
+		AShooterAIController* AIC = CreateBot(NextBotNum++);
+		NumPendingBotCreations--;
+		NumProcessed++;
+
+		// match started before all bots were created
+		if (AIC && IsMatchInProgress())
+		{
+			PendingBotSpawns.Add(AIC);
+		}
+	}
+
+	while (PendingBotSpawns.Num() > 0 && HasBudget())
+	{
+		AShooterAIController* AIC = PendingBotSpawns[0].Get();
+		PendingBotSpawns.RemoveAt(0, 1, false);
+
+		if (AIC && AIC->GetPawn() == nullptr)
+		{
+			RestartPlayer(AIC);
+			NumProcessed++;
+		}
+	}
+
+	const double FrameMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	BotQueueFrames++;
+	BotQueueProcessed += NumProcessed;
+	BotQueueWorstFrameMs = FMath::Max(BotQueueWorstFrameMs, FrameMs);
+
+	if (NumPendingBotCreations == 0 && PendingBotSpawns.Num() == 0)
+	{
+		UE_LOG(LogShooter, Log, TEXT("Bot queue drained: %d bot creations/spawns over %d frames, worst frame %.2f ms (BotSpawnsPerFrame=%d, BotSpawnBudgetMs=%.1f)"),
+			BotQueueProcessed, BotQueueFrames, BotQueueWorstFrameMs, BotSpawnsPerFrame, BotSpawnBudgetMs);
+
+		BotQueueFrames = 0;
+		BotQueueProcessed = 0;
+		BotQueueWorstFrameMs = 0.0;
+	}
 }
 
 void AShooterGameMode::InitBot(AShooterAIController* AIController, int32 BotNum)
@@ -12,19 +12,167 @@ AShooterGameState::AShooterGameState(const FObjectInitializer& ObjectInitializer
 	RemainingTime = 0;
 	bTimerPaused = false;
 
+	PrimaryActorTick.bCanEverTick = true;
+
 	UShooterGameInstance* GameInstance = GetWorld() != nullptr ? Cast<UShooterGameInstance>(GetWorld()->GetGameInstance()) : nullptr;
 
 	GameMatches.Initialize(this, GameInstance);
 }
 
+void AShooterGameState::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	ProjectileManager.Initialize(GetWorld());
+	ImpactEffectManager.Initialize(GetWorld());
+	AudioManager.Initialize(GetWorld());
+	RagdollManager.Initialize(GetWorld());
+
+	if (HasAuthority())
+	{
+		PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &AShooterGameState::SendKillFeed);
+	}
+}
+
+void AShooterGameState::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	ProjectileManager.Tick(DeltaSeconds);
+	ImpactEffectManager.Tick();
+	AudioManager.Tick();
+	RagdollManager.Tick();
+	MatchEndPipeline.Tick();
+}
+
+void AShooterGameState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// don't lose match results queued right before travel
+	MatchEndPipeline.Flush();
+
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AShooterGameState::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & OutLifetimeProps ) const
 {
 	Super::GetLifetimeReplicatedProps( OutLifetimeProps );
 
-	DOREPLIFETIME( AShooterGameState, NumTeams );
-	DOREPLIFETIME( AShooterGameState, RemainingTime );
-	DOREPLIFETIME( AShooterGameState, bTimerPaused );
-	DOREPLIFETIME( AShooterGameState, TeamScores );
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST( AShooterGameState, NumTeams, Params );
+	DOREPLIFETIME_WITH_PARAMS_FAST( AShooterGameState, RemainingTime, Params );
+	DOREPLIFETIME_WITH_PARAMS_FAST( AShooterGameState, bTimerPaused, Params );
+	DOREPLIFETIME_WITH_PARAMS_FAST( AShooterGameState, TeamScores, Params );
+	DOREPLIFETIME_WITH_PARAMS_FAST( AShooterGameState, KillFeedDamageTypes, Params );
+}
+
+void AShooterGameState::AddKillFeedEntry(AShooterPlayerState* KillerPlayerState, AShooterPlayerState* VictimPlayerState, const UDamageType* KillerDamageType)
+{
+	if (VictimPlayerState == NULL)
+	{
+		return;
+	}
+
+	FShooterKillFeedEntry& Entry = PendingKillFeed.AddDefaulted_GetRef();
+	Entry.KillerId = KillerPlayerState ? KillerPlayerState->GetPlayerId() : INDEX_NONE;
+	Entry.VictimId = VictimPlayerState->GetPlayerId();
+	Entry.Flags = (KillerPlayerState == NULL || KillerPlayerState == VictimPlayerState) ? EShooterKillFeedFlags::Suicide : 0;
+
+	if (KillerDamageType)
+	{
+		Entry.DamageTypeIndex = KillFeedDamageTypes.Find(KillerDamageType->GetClass());
+		if (Entry.DamageTypeIndex == INDEX_NONE)
+		{
+			Entry.DamageTypeIndex = KillFeedDamageTypes.Add(KillerDamageType->GetClass());
+			MARK_PROPERTY_DIRTY_FROM_NAME(AShooterGameState, KillFeedDamageTypes, this);
+		}
+	}
+}
+
+void AShooterGameState::SendKillFeed(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld == GetWorld() && PendingKillFeed.Num() > 0)
+	{
+		MulticastKillFeed(PendingKillFeed);
+		PendingKillFeed.Reset();
+	}
+}
+
+void AShooterGameState::MulticastKillFeed_Implementation(const TArray<FShooterKillFeedEntry>& Entries)
+{
+	for (const FShooterKillFeedEntry& Entry : Entries)
+	{
+		// keep order of kills, once one waits for its damage type the rest waits too
+		if (UnresolvedKillFeed.Num() > 0 || !ShowKillFeedEntry(Entry))
+		{
+			UnresolvedKillFeed.Add(Entry);
+		}
+	}
+}
+
+void AShooterGameState::OnRep_KillFeedDamageTypes()
+{
+	int32 NumShown = 0;
+	while (NumShown < UnresolvedKillFeed.Num() && ShowKillFeedEntry(UnresolvedKillFeed[NumShown]))
+	{
+		NumShown++;
+	}
+
+	UnresolvedKillFeed.RemoveAt(0, NumShown);
+}
+
+bool AShooterGameState::ShowKillFeedEntry(const FShooterKillFeedEntry& Entry)
+{
+	if (!KillFeedDamageTypes.IsValidIndex(Entry.DamageTypeIndex) && Entry.DamageTypeIndex != INDEX_NONE)
+	{
+		return false;
+	}
+
+	const UDamageType* KillerDamageType = Entry.DamageTypeIndex != INDEX_NONE && *KillFeedDamageTypes[Entry.DamageTypeIndex] ?
+		KillFeedDamageTypes[Entry.DamageTypeIndex]->GetDefaultObject<UDamageType>() : NULL;
+	AShooterPlayerState* KillerPlayerState = FindPlayerState(Entry.KillerId);
+	AShooterPlayerState* VictimPlayerState = FindPlayerState(Entry.VictimId);
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		// all local players get death messages so they can update their huds.
+		AShooterPlayerController* TestPC = Cast<AShooterPlayerController>(*It);
+		if (TestPC && TestPC->IsLocalController())
+		{
+			if (KillerPlayerState && TestPC->PlayerState == KillerPlayerState && !(Entry.Flags & EShooterKillFeedFlags::Suicide))
+			{
+				TestPC->OnKill();
+			}
+
+			if (VictimPlayerState)
+			{
+				TestPC->OnDeathMessage(KillerPlayerState, VictimPlayerState, KillerDamageType);
+			}
+		}
+	}
+
+	return true;
+}
+
+AShooterPlayerState* AShooterGameState::FindPlayerState(int32 PlayerId) const
+{
+	if (PlayerId == INDEX_NONE)
+	{
+		return NULL;
+	}
+
+	for (APlayerState* PlayerState : PlayerArray)
+	{
+		if (PlayerState && PlayerState->GetPlayerId() == PlayerId)
+		{
+			return Cast<AShooterPlayerState>(PlayerState);
+		}
+	}
+
+	return NULL;
 }
 
 void AShooterGameState::GetRankedMap(int32 TeamIndex, RankedPlayerMap& OutRankedMap) const
@@ -95,5 +243,9 @@ void AShooterGameState::HandleMatchHasStarted()
 void AShooterGameState::HandleMatchHasEnded()
 {
 	Super::HandleMatchHasEnded();
-	GameMatches.HandleMatchHasEnded(bEnableGameFeedback, NumTeams, MakeArrayView(TeamScores));
+
+	FShooterMatchEndPipeline::QueueJob(this, TEXT("GameMatches"), [this]()
+	{
+		GameMatches.HandleMatchHasEnded(bEnableGameFeedback, NumTeams, MakeArrayView(TeamScores));
+	});
 }
\ No newline at end of file
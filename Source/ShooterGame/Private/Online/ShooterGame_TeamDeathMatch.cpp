@@ -30,6 +30,7 @@ void AShooterGame_TeamDeathMatch::InitGameState()
 	if (MyGameState)
 	{
 		MyGameState->NumTeams = NumTeams;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterGameState, NumTeams, MyGameState);
 	}
 }
 
@@ -0,0 +1,133 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Online/ShooterMatchEndPipeline.h"
+
+static int32 ShooterMatchEndTimeSlice = 1;
+FAutoConsoleVariableRef CVarShooterMatchEndTimeSlice(
+	TEXT("ShooterMatchEnd.TimeSlice"),
+	ShooterMatchEndTimeSlice,
+	TEXT("Spread end of match work over several frames instead of running it when match ends.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+static float ShooterMatchEndFrameBudget = 2.0f;
+FAutoConsoleVariableRef CVarShooterMatchEndFrameBudget(
+	TEXT("ShooterMatchEnd.FrameBudget"),
+	ShooterMatchEndFrameBudget,
+	TEXT("Time (ms) end of match jobs may take per frame, at least one job runs every frame."),
+	ECVF_Default);
+
+FShooterMatchEndPipeline::FShooterMatchEndPipeline()
+	: NextJob(0)
+{
+	FMemory::Memzero(RunStats);
+	FMemory::Memzero(LastRunStats);
+}
+
+FShooterMatchEndPipeline* FShooterMatchEndPipeline::Get(const UObject* WorldContextObject)
+{
+	UWorld* MyWorld = WorldContextObject ? WorldContextObject->GetWorld() : NULL;
+	AShooterGameState* GameState = MyWorld ? MyWorld->GetGameState<AShooterGameState>() : NULL;
+	return GameState ? &GameState->GetMatchEndPipeline() : NULL;
+}
+
+void FShooterMatchEndPipeline::QueueJob(const UObject* WorldContextObject, const TCHAR* Name, TFunction<void()>&& Job)
+{
+	FShooterMatchEndPipeline* Pipeline = ShooterMatchEndTimeSlice > 0 ? Get(WorldContextObject) : NULL;
+	if (Pipeline)
+	{
+		Pipeline->AddJob(Name, MoveTemp(Job));
+	}
+	else
+	{
+		Job();
+	}
+}
+
+void FShooterMatchEndPipeline::AddJob(const TCHAR* Name, TFunction<void()>&& Job)
+{
+	FJob& NewJob = Jobs.AddDefaulted_GetRef();
+	NewJob.Name = Name;
+	NewJob.Function = MoveTemp(Job);
+}
+
+void FShooterMatchEndPipeline::RunNextJob()
+{
+	// job may queue more jobs, don't keep reference into array while it runs
+	const TCHAR* Name = Jobs[NextJob].Name;
+	TFunction<void()> Function = MoveTemp(Jobs[NextJob].Function);
+	NextJob++;
+
+	const double StartTime = FPlatformTime::Seconds();
+	Function();
+	const double JobTime = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	UE_LOG(LogShooter, Verbose, TEXT("Match end job %s: %.3f ms"), Name, JobTime);
+
+	RunStats.NumJobs++;
+	RunStats.TotalTime += JobTime;
+	if (JobTime > RunStats.LongestJobTime)
+	{
+		RunStats.LongestJobTime = JobTime;
+		RunStats.LongestJobName = Name;
+	}
+}
+
+void FShooterMatchEndPipeline::FinishRun()
+{
+	Jobs.Reset();
+	NextJob = 0;
+
+	LastRunStats = RunStats;
+	FMemory::Memzero(RunStats);
+
+	UE_LOG(LogShooter, Log, TEXT("Match end: %d jobs over %d frames, %.2f ms total, longest frame %.2f ms, longest job %s %.2f ms"),
+		LastRunStats.NumJobs, LastRunStats.NumFrames, LastRunStats.TotalTime, LastRunStats.LongestFrameTime,
+		LastRunStats.LongestJobName ? LastRunStats.LongestJobName : TEXT("none"), LastRunStats.LongestJobTime);
+}
+
+void FShooterMatchEndPipeline::Tick()
+{
+	if (GetNumPendingJobs() == 0)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ShooterMatchEndPipeline_Tick);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double Budget = ShooterMatchEndFrameBudget / 1000.0;
+	do
+	{
+		RunNextJob();
+	}
+	while (GetNumPendingJobs() > 0 && FPlatformTime::Seconds() - StartTime < Budget);
+
+	RunStats.NumFrames++;
+	RunStats.LongestFrameTime = FMath::Max(RunStats.LongestFrameTime, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	if (GetNumPendingJobs() == 0)
+	{
+		FinishRun();
+	}
+}
+
+void FShooterMatchEndPipeline::Flush()
+{
+	if (GetNumPendingJobs() == 0)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	while (GetNumPendingJobs() > 0)
+	{
+		RunNextJob();
+	}
+
+	RunStats.NumFrames++;
+	RunStats.LongestFrameTime = FMath::Max(RunStats.LongestFrameTime, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	FinishRun();
+}
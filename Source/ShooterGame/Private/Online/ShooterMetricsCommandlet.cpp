@@ -0,0 +1,74 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Online/ShooterMetricsCommandlet.h"
+#include "Online/ShooterServerMetrics.h"
+#include "Dom/JsonObject.h"
+
+UShooterMetricsCommandlet::UShooterMetricsCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UShooterMetricsCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+	const FString FilePath = ParamVals.FindRef(TEXT("File"));
+	FString Text;
+	if (FilePath.IsEmpty() || !FFileHelper::LoadFileToString(Text, *FilePath))
+	{
+		UE_LOG(LogShooter, Error, TEXT("Can't read metrics file '%s', use -File=<path>"), *FilePath);
+		return 1;
+	}
+
+	TArray<TSharedPtr<FJsonObject>> Snapshots;
+	FString Error;
+	if (!FShooterServerMetrics::ReadSnapshots(Text, Snapshots, Error))
+	{
+		UE_LOG(LogShooter, Error, TEXT("%s: %s"), *FilePath, *Error);
+		return 1;
+	}
+
+	const int32 MinSnapshots = FCString::Atoi(*ParamVals.FindRef(TEXT("MinSnapshots")));
+	if (Snapshots.Num() < MinSnapshots || Snapshots.Num() == 0)
+	{
+		UE_LOG(LogShooter, Error, TEXT("%s: %d snapshots, expected at least %d"), *FilePath, Snapshots.Num(), FMath::Max(MinSnapshots, 1));
+		return 1;
+	}
+
+	const TSharedPtr<FJsonObject>& Snapshot = Snapshots.Last();
+	const TSharedPtr<FJsonObject> Tick = Snapshot->GetObjectField(TEXT("tick"));
+	const TSharedPtr<FJsonObject> Players = Snapshot->GetObjectField(TEXT("players"));
+	const TSharedPtr<FJsonObject> GC = Snapshot->GetObjectField(TEXT("gc"));
+	const TSharedPtr<FJsonObject> Memory = Snapshot->GetObjectField(TEXT("memory"));
+
+	UE_LOG(LogShooter, Display, TEXT("%s: %d snapshots, latest %s on %s"), *FilePath, Snapshots.Num(),
+		*Snapshot->GetStringField(TEXT("time")), *Snapshot->GetStringField(TEXT("map")));
+	UE_LOG(LogShooter, Display, TEXT("Tick: %d frames, p50 %.2f ms, p90 %.2f ms, p99 %.2f ms, max %.2f ms"),
+		(int32)Tick->GetNumberField(TEXT("frames")), Tick->GetNumberField(TEXT("p50_ms")), Tick->GetNumberField(TEXT("p90_ms")),
+		Tick->GetNumberField(TEXT("p99_ms")), Tick->GetNumberField(TEXT("max_ms")));
+	UE_LOG(LogShooter, Display, TEXT("Players: %d humans, %d bots, %d spectators"),
+		(int32)Players->GetNumberField(TEXT("humans")), (int32)Players->GetNumberField(TEXT("bots")), (int32)Players->GetNumberField(TEXT("spectators")));
+
+	for (const TSharedPtr<FJsonValue>& ConnectionValue : Snapshot->GetArrayField(TEXT("connections")))
+	{
+		const TSharedPtr<FJsonObject> Connection = ConnectionValue->AsObject();
+		UE_LOG(LogShooter, Display, TEXT("Connection %s: ping %.0f ms, in %d B/s, out %d B/s"),
+			*Connection->GetStringField(TEXT("name")), Connection->GetNumberField(TEXT("ping_ms")),
+			(int32)Connection->GetNumberField(TEXT("in_bytes_per_sec")), (int32)Connection->GetNumberField(TEXT("out_bytes_per_sec")));
+	}
+
+	UE_LOG(LogShooter, Display, TEXT("GC: %d collections, %.2f ms total, %.2f ms max. Memory: %.0f MB used, %.0f MB peak"),
+		(int32)GC->GetNumberField(TEXT("collections")), GC->GetNumberField(TEXT("total_ms")), GC->GetNumberField(TEXT("max_ms")),
+		Memory->GetNumberField(TEXT("used_physical_mb")), Memory->GetNumberField(TEXT("peak_used_physical_mb")));
+
+	return 0;
+}
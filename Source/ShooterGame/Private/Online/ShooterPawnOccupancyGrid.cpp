@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Online/ShooterPawnOccupancyGrid.h"
+#include "Online/ShooterPlayerState.h"
+
+FShooterPawnOccupancyGrid::FShooterPawnOccupancyGrid()
+	: CellSize(1000.0f)
+	, LastUpdateFrame(MAX_uint64)
+{
+}
+
+FIntPoint FShooterPawnOccupancyGrid::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void FShooterPawnOccupancyGrid::Update(UWorld* World)
+{
+	if (LastUpdateFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	LastUpdateFrame = GFrameCounter;
+	Entries.Reset();
+	Cells.Reset();
+
+	for (ACharacter* Pawn : TActorRange<ACharacter>(World))
+	{
+		AddPawn(Pawn);
+	}
+}
+
+void FShooterPawnOccupancyGrid::AddSpawnedPawn(ACharacter* Pawn)
+{
+	// grid from earlier frame is rebuilt by next Update anyway
+	if (Pawn && LastUpdateFrame == GFrameCounter)
+	{
+		AddPawn(Pawn);
+	}
+}
+
+void FShooterPawnOccupancyGrid::AddPawn(ACharacter* Pawn)
+{
+	UCapsuleComponent* Capsule = Pawn->GetCapsuleComponent();
+	if (Capsule == NULL)
+	{
+		return;
+	}
+
+	AShooterCharacter* ShooterPawn = Cast<AShooterCharacter>(Pawn);
+
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Location = Pawn->GetActorLocation();
+	Entry.ViewDirection = Pawn->GetBaseAimRotation().Vector();
+	Entry.Radius = Capsule->GetScaledCapsuleRadius();
+	Entry.HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+	Entry.PlayerState = Cast<AShooterPlayerState>(Pawn->GetPlayerState());
+	Entry.bAlive = ShooterPawn ? ShooterPawn->IsAlive() : true;
+
+	// capsules are small compared to cell, register by center only and let queries pad their radius
+	Cells.FindOrAdd(GetCell(Entry.Location)).Add(Entries.Num() - 1);
+}
@@ -22,6 +22,8 @@ void AShooterPlayerState::Reset()
 	//SetTeamNum(0);
 	NumKills = 0;
 	NumDeaths = 0;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterPlayerState, NumKills, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterPlayerState, NumDeaths, this);
 	NumBulletsFired = 0;
 	NumRocketsFired = 0;
 	bQuitter = false;
@@ -53,6 +55,7 @@ void AShooterPlayerState::ClientInitialize(AController* InController)
 void AShooterPlayerState::SetTeamNum(int32 NewTeamNumber)
 {
 	TeamNumber = NewTeamNumber;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterPlayerState, TeamNumber, this);
 
 	UpdateTeamColors();
 }
@@ -90,6 +93,7 @@ void AShooterPlayerState::CopyProperties(APlayerState* PlayerState)
 	if (ShooterPlayer)
 	{
 		ShooterPlayer->TeamNumber = TeamNumber;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterPlayerState, TeamNumber, ShooterPlayer);
 	}	
 }
 
@@ -144,12 +148,14 @@ FString AShooterPlayerState::GetMatchId() const
 void AShooterPlayerState::ScoreKill(AShooterPlayerState* Victim, int32 Points)
 {
 	NumKills++;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterPlayerState, NumKills, this);
 	ScorePoints(Points);
 }
 
 void AShooterPlayerState::ScoreDeath(AShooterPlayerState* KilledBy, int32 Points)
 {
 	NumDeaths++;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterPlayerState, NumDeaths, this);
 	ScorePoints(Points);
 }
 
@@ -164,54 +170,22 @@ void AShooterPlayerState::ScorePoints(int32 Points)
 		}
 
 		MyGameState->TeamScores[TeamNumber] += Points;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterGameState, TeamScores, MyGameState);
 	}
 
 	SetScore(GetScore() + Points);
 }
 
-void AShooterPlayerState::InformAboutKill_Implementation(class AShooterPlayerState* KillerPlayerState, const UDamageType* KillerDamageType, class AShooterPlayerState* KilledPlayerState)
-{
-	//id can be null for bots
-	if (KillerPlayerState->GetUniqueId().IsValid())
-	{	
-		//search for the actual killer before calling OnKill()	
-		for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
-		{		
-			AShooterPlayerController* TestPC = Cast<AShooterPlayerController>(*It);
-			if (TestPC && TestPC->IsLocalController())
-			{
-				// a local player might not have an ID if it was created with CreateDebugPlayer.
-				ULocalPlayer* LocalPlayer = Cast<ULocalPlayer>(TestPC->Player);
-				FUniqueNetIdRepl LocalID = LocalPlayer->GetCachedUniqueNetId();
-				if (LocalID.IsValid() &&  *LocalPlayer->GetCachedUniqueNetId() == *KillerPlayerState->GetUniqueId())
-				{			
-					TestPC->OnKill();
-				}
-			}
-		}
-	}
-}
-
-void AShooterPlayerState::BroadcastDeath_Implementation(class AShooterPlayerState* KillerPlayerState, const UDamageType* KillerDamageType, class AShooterPlayerState* KilledPlayerState)
-{	
-	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
-	{
-		// all local players get death messages so they can update their huds.
-		AShooterPlayerController* TestPC = Cast<AShooterPlayerController>(*It);
-		if (TestPC && TestPC->IsLocalController())
-		{
-			TestPC->OnDeathMessage(KillerPlayerState, this, KillerDamageType);				
-		}
-	}	
-}
-
 void AShooterPlayerState::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & OutLifetimeProps ) const
 {
 	Super::GetLifetimeReplicatedProps( OutLifetimeProps );
 
-	DOREPLIFETIME( AShooterPlayerState, TeamNumber );
-	DOREPLIFETIME( AShooterPlayerState, NumKills );
-	DOREPLIFETIME( AShooterPlayerState, NumDeaths );
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST( AShooterPlayerState, TeamNumber, Params );
+	DOREPLIFETIME_WITH_PARAMS_FAST( AShooterPlayerState, NumKills, Params );
+	DOREPLIFETIME_WITH_PARAMS_FAST( AShooterPlayerState, NumDeaths, Params );
 }
 
 FString AShooterPlayerState::GetShortPlayerName() const
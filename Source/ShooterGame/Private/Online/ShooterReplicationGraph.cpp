@@ -129,6 +129,34 @@ static FAutoConsoleVariableRef CVarShooterRepDisableSpatialRebuilds(TEXT("Shoote
 
 UShooterReplicationGraph::UShooterReplicationGraph()
 {
+	FMemory::Memzero(NumRoutedActors);
+	ResetReplicateStats();
+}
+
+void UShooterReplicationGraph::ResetReplicateStats()
+{
+	ReplicateCycles = 0;
+	MaxReplicateCycles = 0;
+	NumReplicateFrames = 0;
+}
+
+int32 UShooterReplicationGraph::ServerReplicateActors(float DeltaSeconds)
+{
+	const uint32 StartCycles = FPlatformTime::Cycles();
+	const int32 Result = Super::ServerReplicateActors(DeltaSeconds);
+	const uint32 FrameCycles = FPlatformTime::Cycles() - StartCycles;
+
+	ReplicateCycles += FrameCycles;
+	MaxReplicateCycles = FMath::Max<uint64>(MaxReplicateCycles, FrameCycles);
+	NumReplicateFrames++;
+
+	return Result;
+}
+
+/** frames between replication of actors with update frequency, keeps their rate in real time at any server tick rate */
+uint32 GetReplicationPeriodFrame(float NetUpdateFrequency, float ServerMaxTickRate)
+{
+	return FMath::Max<uint32>( (uint32)FMath::RoundToFloat(ServerMaxTickRate / NetUpdateFrequency), 1);
 }
 
 void InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, bool bSpatialize, float ServerMaxTickRate)
@@ -140,7 +168,7 @@ void InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, bool b
 		UE_LOG(LogShooterReplicationGraph, Log, TEXT("Setting cull distance for %s to %f (%f)"), *Class->GetName(), Info.GetCullDistanceSquared(), Info.GetCullDistance());
 	}
 
-	Info.ReplicationPeriodFrame = FMath::Max<uint32>( (uint32)FMath::RoundToFloat(ServerMaxTickRate / CDO->NetUpdateFrequency), 1);
+	Info.ReplicationPeriodFrame = GetReplicationPeriodFrame(CDO->NetUpdateFrequency, ServerMaxTickRate);
 
 	UClass* NativeClass = Class;
 	while(!NativeClass->IsNative() && NativeClass->GetSuperClass() && NativeClass->GetSuperClass() != AActor::StaticClass())
@@ -151,11 +179,49 @@ void InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, bool b
 	UE_LOG(LogShooterReplicationGraph, Log, TEXT("Setting replication period for %s (%s) to %d frames (%.2f)"), *Class->GetName(), *NativeClass->GetName(), Info.ReplicationPeriodFrame, CDO->NetUpdateFrequency);
 }
 
+void UShooterReplicationGraph::OnServerTickRateChanged(float ServerMaxTickRate)
+{
+	for (UClass* Class : TickRateScaledClasses)
+	{
+		FClassReplicationInfo& ClassInfo = GlobalActorReplicationInfoMap.GetClassInfo(Class);
+		ClassInfo.ReplicationPeriodFrame = GetReplicationPeriodFrame(Class->GetDefaultObject<AActor>()->NetUpdateFrequency, ServerMaxTickRate);
+	}
+
+	// connections copied period of actor when they first saw it, and schedule from their copy.
+	// Only copies still matching the actor's period are updated, explicit overrides like owner's PlayerState stay
+	for (UNetReplicationGraphConnection* ConnManager : Connections)
+	{
+		for (auto It = ConnManager->ActorInfoMap.CreateIterator(); It; ++It)
+		{
+			AActor* Actor = It.Key();
+			FConnectionReplicationActorInfo* ConnectionActorInfo = It.Value().Get();
+			FGlobalActorReplicationInfo* GlobalInfo = Actor ? GlobalActorReplicationInfoMap.Find(Actor) : NULL;
+			if (ConnectionActorInfo && GlobalInfo && ConnectionActorInfo->ReplicationPeriodFrame == GlobalInfo->Settings.ReplicationPeriodFrame)
+			{
+				ConnectionActorInfo->ReplicationPeriodFrame = GlobalActorReplicationInfoMap.GetClassInfo(Actor->GetClass()).ReplicationPeriodFrame;
+			}
+		}
+	}
+
+	// actors copied settings of their class when they were added
+	for (auto It = GlobalActorReplicationInfoMap.CreateActorMapIterator(); It; ++It)
+	{
+		AActor* Actor = It.Key();
+		if (Actor)
+		{
+			It.Value()->Settings.ReplicationPeriodFrame = GlobalActorReplicationInfoMap.GetClassInfo(Actor->GetClass()).ReplicationPeriodFrame;
+		}
+	}
+
+	UE_LOG(LogShooterReplicationGraph, Log, TEXT("Recomputed replication periods of %d classes for server tick rate %.0f"), TickRateScaledClasses.Num(), ServerMaxTickRate);
+}
+
 void UShooterReplicationGraph::ResetGameWorldState()
 {
 	Super::ResetGameWorldState();
 
 	AlwaysRelevantStreamingLevelActors.Empty();
+	FMemory::Memzero(NumRoutedActors);
 
 	for (UNetReplicationGraphConnection* ConnManager : Connections)
 	{
@@ -304,6 +370,7 @@ void UShooterReplicationGraph::InitGlobalActorClassSettings()
 		FClassReplicationInfo ClassInfo;
 		InitClassReplicationInfo(ClassInfo, ReplicatedClass, bClassIsSpatialized, NetDriver->NetServerMaxTickRate);
 		GlobalActorReplicationInfoMap.SetClassInfo( ReplicatedClass, ClassInfo );
+		TickRateScaledClasses.Add(ReplicatedClass);
 	}
 
 
@@ -415,6 +482,7 @@ EClassRepNodeMapping UShooterReplicationGraph::GetMappingPolicy(UClass* Class)
 void UShooterReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
 {
 	EClassRepNodeMapping Policy = GetMappingPolicy(ActorInfo.Class);
+	NumRoutedActors[(int32)Policy]++;
 	switch(Policy)
 	{
 		case EClassRepNodeMapping::NotRouted:
@@ -460,6 +528,7 @@ void UShooterReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedA
 void UShooterReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
 {
 	EClassRepNodeMapping Policy = GetMappingPolicy(ActorInfo.Class);
+	NumRoutedActors[(int32)Policy]--;
 	switch(Policy)
 	{
 		case EClassRepNodeMapping::NotRouted:
@@ -44,6 +44,7 @@ public:
 	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
 	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
 	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual int32 ServerReplicateActors(float DeltaSeconds) override;
 	
 	UPROPERTY()
 	TArray<UClass*>	SpatializedClasses;
@@ -54,6 +55,10 @@ public:
 	UPROPERTY()
 	TArray<UClass*>	AlwaysRelevantClasses;
 	
+	/** classes with replication period derived from server tick rate */
+	UPROPERTY()
+	TArray<UClass*> TickRateScaledClasses;
+
 	UPROPERTY()
 	UReplicationGraphNode_GridSpatialization2D* GridNode;
 
@@ -71,6 +76,19 @@ public:
 
 	void PrintRepNodePolicies();
 
+	/** recomputes replication periods of classes and actors, so their update rate in real time stays the same */
+	void OnServerTickRateChanged(float ServerMaxTickRate);
+
+	/** actors routed to nodes, by EClassRepNodeMapping. For server metrics */
+	int32 NumRoutedActors[(int32)EClassRepNodeMapping::Spatialize_Dormancy + 1];
+
+	/** time spent replicating actors and frames it was spread over since last ResetReplicateStats. For server metrics */
+	uint64 ReplicateCycles;
+	uint64 MaxReplicateCycles;
+	int32 NumReplicateFrames;
+
+	void ResetReplicateStats();
+
 private:
 
 	EClassRepNodeMapping GetMappingPolicy(UClass* Class);
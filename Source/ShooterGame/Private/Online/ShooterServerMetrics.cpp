@@ -0,0 +1,378 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Online/ShooterServerMetrics.h"
+#include "Online/ShooterReplicationGraph.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+static int32 ShooterMetricsEnable = 1;
+FAutoConsoleVariableRef CVarShooterMetricsEnable(
+	TEXT("ShooterMetrics.Enable"),
+	ShooterMetricsEnable,
+	TEXT("Write periodic server health snapshots to Saved/Metrics, or file given by -MetricsFile=.\n")
+	TEXT("0: Disable, 1: Dedicated servers, 2: Dedicated and listen servers"),
+	ECVF_Default);
+
+static float ShooterMetricsInterval = 10.0f;
+FAutoConsoleVariableRef CVarShooterMetricsInterval(
+	TEXT("ShooterMetrics.Interval"),
+	ShooterMetricsInterval,
+	TEXT("Time (s) between server health snapshots."),
+	ECVF_Default);
+
+static int32 ShooterMetricsMaxFileSize = 64;
+FAutoConsoleVariableRef CVarShooterMetricsMaxFileSize(
+	TEXT("ShooterMetrics.MaxFileSize"),
+	ShooterMetricsMaxFileSize,
+	TEXT("Size (MB) of metrics file before it's moved to .1 and started over."),
+	ECVF_Default);
+
+FAutoConsoleCommandWithWorld ShooterMetricsSnapshotCmd(TEXT("ShooterMetrics.Snapshot"), TEXT("Writes server health snapshot right away and logs it"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		FShooterServerMetrics* Metrics = FShooterServerMetrics::Get(World);
+		if (Metrics)
+		{
+			UE_LOG(LogShooter, Display, TEXT("%s"), *Metrics->WriteSnapshot());
+		}
+	})
+);
+
+/** fields every snapshot has, checked by ReadSnapshots */
+static const TCHAR* RequiredSnapshotFields[] = { TEXT("time"), TEXT("map"), TEXT("tick"), TEXT("players"), TEXT("connections"), TEXT("repgraph"), TEXT("gc"), TEXT("memory") };
+
+FShooterFrameWorkSampler::FShooterFrameWorkSampler()
+	: NumSamples(0)
+	, NextSample(0)
+{
+}
+
+void FShooterFrameWorkSampler::AddFrame()
+{
+	// time spent waiting for next frame isn't load
+	Samples[NextSample] = (float)FMath::Max(FApp::GetDeltaTime() - FApp::GetIdleTime(), 0.0) * 1000.0f;
+	NextSample = (NextSample + 1) % MaxSamples;
+	NumSamples = FMath::Min(NumSamples + 1, (int32)MaxSamples);
+}
+
+void FShooterFrameWorkSampler::Reset()
+{
+	NumSamples = 0;
+	NextSample = 0;
+}
+
+void FShooterFrameWorkSampler::Sort()
+{
+	SortedSamples.Reset();
+	SortedSamples.Append(Samples, NumSamples);
+	SortedSamples.Sort();
+}
+
+float FShooterFrameWorkSampler::GetPercentile(float Percentile) const
+{
+	if (SortedSamples.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * SortedSamples.Num()) - 1, 0, SortedSamples.Num() - 1);
+	return SortedSamples[Index];
+}
+
+float FShooterFrameWorkSampler::GetMax() const
+{
+	return SortedSamples.Num() > 0 ? SortedSamples.Last() : 0.0f;
+}
+
+FShooterServerMetrics::FShooterServerMetrics()
+	: NumSnapshots(0)
+	, LastSnapshotTime(0.0)
+	, NumFrames(0)
+	, TotalFrameTime(0.0)
+	, LastSnapshotSeconds(0.0)
+	, NumCollections(0)
+	, CollectionTime(0.0)
+	, MaxCollectionTime(0.0)
+	, CollectionStartSeconds(0.0)
+	, File(NULL)
+{
+}
+
+FShooterServerMetrics::~FShooterServerMetrics()
+{
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+	delete File;
+}
+
+void FShooterServerMetrics::Initialize(UWorld* InWorld)
+{
+	World = InWorld;
+	LastSnapshotSeconds = FPlatformTime::Seconds();
+
+	PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddRaw(this, &FShooterServerMetrics::OnPreGarbageCollect);
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FShooterServerMetrics::OnPostGarbageCollect);
+}
+
+FShooterServerMetrics* FShooterServerMetrics::Get(const UObject* WorldContextObject)
+{
+	UWorld* MyWorld = WorldContextObject ? WorldContextObject->GetWorld() : NULL;
+	AShooterGameMode* GameMode = MyWorld ? MyWorld->GetAuthGameMode<AShooterGameMode>() : NULL;
+	return GameMode ? &GameMode->GetServerMetrics() : NULL;
+}
+
+void FShooterServerMetrics::OnPreGarbageCollect()
+{
+	CollectionStartSeconds = FPlatformTime::Seconds();
+}
+
+void FShooterServerMetrics::OnPostGarbageCollect()
+{
+	const double Time = (FPlatformTime::Seconds() - CollectionStartSeconds) * 1000.0;
+	NumCollections++;
+	CollectionTime += Time;
+	MaxCollectionTime = FMath::Max(MaxCollectionTime, Time);
+}
+
+void FShooterServerMetrics::Tick()
+{
+	UWorld* MyWorld = World.Get();
+	const ENetMode NetMode = MyWorld ? MyWorld->GetNetMode() : NM_Standalone;
+	const bool bEnabled = (ShooterMetricsEnable >= 1 && NetMode == NM_DedicatedServer) || (ShooterMetricsEnable >= 2 && NetMode == NM_ListenServer);
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	FrameSamples.AddFrame();
+	NumFrames++;
+	TotalFrameTime += FApp::GetDeltaTime();
+
+	if (FPlatformTime::Seconds() - LastSnapshotSeconds >= ShooterMetricsInterval)
+	{
+		WriteSnapshot();
+	}
+}
+
+FString FShooterServerMetrics::WriteSnapshot()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ShooterServerMetrics_WriteSnapshot);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FString Line;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Line);
+	FJsonSerializer::Serialize(BuildSnapshot(), Writer);
+	AppendLine(Line);
+
+	NumSnapshots++;
+	LastSnapshotTime = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	UE_LOG(LogShooter, Verbose, TEXT("Server metrics snapshot: %d bytes, %.3f ms"), Line.Len(), LastSnapshotTime);
+
+	return Line;
+}
+
+TSharedRef<FJsonObject> FShooterServerMetrics::BuildSnapshot()
+{
+	UWorld* MyWorld = World.Get();
+	const double Now = FPlatformTime::Seconds();
+
+	TSharedRef<FJsonObject> Snapshot = MakeShared<FJsonObject>();
+	Snapshot->SetStringField(TEXT("time"), FDateTime::UtcNow().ToIso8601());
+	Snapshot->SetNumberField(TEXT("interval"), Now - LastSnapshotSeconds);
+	Snapshot->SetStringField(TEXT("map"), MyWorld ? MyWorld->GetMapName() : FString());
+	Snapshot->SetNumberField(TEXT("port"), MyWorld ? MyWorld->URL.Port : 0);
+
+	// tick: work time percentiles of sampled frames
+	FrameSamples.Sort();
+
+	TSharedRef<FJsonObject> Tick = MakeShared<FJsonObject>();
+	Tick->SetNumberField(TEXT("frames"), NumFrames);
+	Tick->SetNumberField(TEXT("avg_frame_ms"), NumFrames > 0 ? TotalFrameTime * 1000.0 / NumFrames : 0.0);
+	Tick->SetNumberField(TEXT("p50_ms"), FrameSamples.GetPercentile(0.5f));
+	Tick->SetNumberField(TEXT("p90_ms"), FrameSamples.GetPercentile(0.9f));
+	Tick->SetNumberField(TEXT("p99_ms"), FrameSamples.GetPercentile(0.99f));
+	Tick->SetNumberField(TEXT("max_ms"), FrameSamples.GetMax());
+	Tick->SetNumberField(TEXT("max_tick_rate"), MyWorld && MyWorld->GetNetDriver() ? MyWorld->GetNetDriver()->NetServerMaxTickRate : 0);
+	Snapshot->SetObjectField(TEXT("tick"), Tick);
+
+	// players
+	int32 NumPlayers = 0;
+	int32 NumBots = 0;
+	int32 NumSpectators = 0;
+	AGameStateBase* const GameState = MyWorld ? MyWorld->GetGameState() : NULL;
+	if (GameState)
+	{
+		for (APlayerState* PlayerState : GameState->PlayerArray)
+		{
+			if (PlayerState == NULL)
+			{
+				continue;
+			}
+
+			if (PlayerState->IsABot())
+			{
+				NumBots++;
+			}
+			else if (PlayerState->IsOnlyASpectator())
+			{
+				NumSpectators++;
+			}
+			else
+			{
+				NumPlayers++;
+			}
+		}
+	}
+
+	TSharedRef<FJsonObject> Players = MakeShared<FJsonObject>();
+	Players->SetNumberField(TEXT("humans"), NumPlayers);
+	Players->SetNumberField(TEXT("bots"), NumBots);
+	Players->SetNumberField(TEXT("spectators"), NumSpectators);
+	Snapshot->SetObjectField(TEXT("players"), Players);
+
+	// connections
+	UNetDriver* NetDriver = MyWorld ? MyWorld->GetNetDriver() : NULL;
+	TArray<TSharedPtr<FJsonValue>> Connections;
+	if (NetDriver)
+	{
+		for (UNetConnection* Connection : NetDriver->ClientConnections)
+		{
+			if (Connection == NULL)
+			{
+				continue;
+			}
+
+			APlayerState* PlayerState = Connection->PlayerController ? Connection->PlayerController->PlayerState : NULL;
+
+			TSharedRef<FJsonObject> ConnectionObject = MakeShared<FJsonObject>();
+			ConnectionObject->SetNumberField(TEXT("player_id"), PlayerState ? PlayerState->GetPlayerId() : INDEX_NONE);
+			ConnectionObject->SetStringField(TEXT("name"), PlayerState ? PlayerState->GetPlayerName() : FString());
+			ConnectionObject->SetNumberField(TEXT("ping_ms"), Connection->AvgLag * 1000.0f);
+			ConnectionObject->SetNumberField(TEXT("in_bytes_per_sec"), Connection->InBytesPerSecond);
+			ConnectionObject->SetNumberField(TEXT("out_bytes_per_sec"), Connection->OutBytesPerSecond);
+			ConnectionObject->SetNumberField(TEXT("in_packets_lost"), Connection->InPacketsLost);
+			ConnectionObject->SetNumberField(TEXT("out_packets_lost"), Connection->OutPacketsLost);
+			Connections.Add(MakeShared<FJsonValueObject>(ConnectionObject));
+		}
+	}
+	Snapshot->SetArrayField(TEXT("connections"), Connections);
+
+	// replication graph
+	TSharedRef<FJsonObject> RepGraph = MakeShared<FJsonObject>();
+	UShooterReplicationGraph* ReplicationGraph = NetDriver ? Cast<UShooterReplicationGraph>(NetDriver->GetReplicationDriver()) : NULL;
+	if (ReplicationGraph)
+	{
+		const double MsPerCycle = FPlatformTime::GetSecondsPerCycle() * 1000.0;
+		RepGraph->SetNumberField(TEXT("always_relevant_actors"), FMath::Max(ReplicationGraph->NumRoutedActors[(int32)EClassRepNodeMapping::RelevantAllConnections], 0));
+		RepGraph->SetNumberField(TEXT("static_actors"), FMath::Max(ReplicationGraph->NumRoutedActors[(int32)EClassRepNodeMapping::Spatialize_Static], 0));
+		RepGraph->SetNumberField(TEXT("dynamic_actors"), FMath::Max(ReplicationGraph->NumRoutedActors[(int32)EClassRepNodeMapping::Spatialize_Dynamic], 0));
+		RepGraph->SetNumberField(TEXT("dormancy_actors"), FMath::Max(ReplicationGraph->NumRoutedActors[(int32)EClassRepNodeMapping::Spatialize_Dormancy], 0));
+		RepGraph->SetNumberField(TEXT("avg_replicate_ms"), ReplicationGraph->NumReplicateFrames > 0 ? ReplicationGraph->ReplicateCycles * MsPerCycle / ReplicationGraph->NumReplicateFrames : 0.0);
+		RepGraph->SetNumberField(TEXT("max_replicate_ms"), ReplicationGraph->MaxReplicateCycles * MsPerCycle);
+		ReplicationGraph->ResetReplicateStats();
+	}
+	Snapshot->SetObjectField(TEXT("repgraph"), RepGraph);
+
+	// garbage collection
+	TSharedRef<FJsonObject> GC = MakeShared<FJsonObject>();
+	GC->SetNumberField(TEXT("collections"), NumCollections);
+	GC->SetNumberField(TEXT("total_ms"), CollectionTime);
+	GC->SetNumberField(TEXT("max_ms"), MaxCollectionTime);
+	GC->SetNumberField(TEXT("objects"), GUObjectArray.GetObjectArrayNumMinusAvailable());
+	Snapshot->SetObjectField(TEXT("gc"), GC);
+
+	// memory
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	TSharedRef<FJsonObject> Memory = MakeShared<FJsonObject>();
+	Memory->SetNumberField(TEXT("used_physical_mb"), MemoryStats.UsedPhysical / (1024.0 * 1024.0));
+	Memory->SetNumberField(TEXT("peak_used_physical_mb"), MemoryStats.PeakUsedPhysical / (1024.0 * 1024.0));
+	Memory->SetNumberField(TEXT("used_virtual_mb"), MemoryStats.UsedVirtual / (1024.0 * 1024.0));
+	Memory->SetNumberField(TEXT("available_physical_mb"), MemoryStats.AvailablePhysical / (1024.0 * 1024.0));
+	Snapshot->SetObjectField(TEXT("memory"), Memory);
+
+	// start next interval
+	FrameSamples.Reset();
+	NumFrames = 0;
+	TotalFrameTime = 0.0;
+	NumCollections = 0;
+	CollectionTime = 0.0;
+	MaxCollectionTime = 0.0;
+	LastSnapshotSeconds = Now;
+
+	return Snapshot;
+}
+
+FString FShooterServerMetrics::GetFilePath() const
+{
+	FString FilePath;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("MetricsFile="), FilePath))
+	{
+		// servers sharing host are told apart by port
+		UWorld* MyWorld = World.Get();
+		FilePath = FPaths::ProjectSavedDir() / TEXT("Metrics") / FString::Printf(TEXT("ShooterServer_%d.jsonl"), MyWorld ? MyWorld->URL.Port : 0);
+	}
+
+	return FilePath;
+}
+
+void FShooterServerMetrics::AppendLine(const FString& Line)
+{
+	const FString FilePath = GetFilePath();
+
+	if (File && File->TotalSize() >= (int64)ShooterMetricsMaxFileSize * 1024 * 1024)
+	{
+		delete File;
+		File = NULL;
+		IFileManager::Get().Move(*(FilePath + TEXT(".1")), *FilePath, true);
+	}
+
+	if (File == NULL)
+	{
+		File = IFileManager::Get().CreateFileWriter(*FilePath, FILEWRITE_Append | FILEWRITE_AllowRead);
+		if (File == NULL)
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Can't open server metrics file %s"), *FilePath);
+			return;
+		}
+	}
+
+	// scrapers read whole lines, write each snapshot in one go
+	FTCHARToUTF8 LineUTF8(*(Line + TEXT("\n")));
+	File->Serialize((void*)LineUTF8.Get(), LineUTF8.Length());
+	File->Flush();
+}
+
+bool FShooterServerMetrics::ReadSnapshots(const FString& Text, TArray<TSharedPtr<FJsonObject>>& OutSnapshots, FString& OutError)
+{
+	TArray<FString> Lines;
+	Text.ParseIntoArrayLines(Lines);
+
+	for (int32 LineIndex = 0; LineIndex < Lines.Num(); LineIndex++)
+	{
+		TSharedPtr<FJsonObject> Snapshot;
+		TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(Lines[LineIndex]);
+		if (!FJsonSerializer::Deserialize(Reader, Snapshot) || !Snapshot.IsValid())
+		{
+			OutError = FString::Printf(TEXT("line %d isn't JSON object: %s"), LineIndex + 1, *Reader->GetErrorMessage());
+			return false;
+		}
+
+		for (const TCHAR* Field : RequiredSnapshotFields)
+		{
+			if (!Snapshot->HasField(Field))
+			{
+				OutError = FString::Printf(TEXT("line %d misses field %s"), LineIndex + 1, Field);
+				return false;
+			}
+		}
+
+		OutSnapshots.Add(Snapshot);
+	}
+
+	return true;
+}
@@ -0,0 +1,278 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Online/ShooterTeamInfluenceMap.h"
+#include "Online/ShooterPlayerState.h"
+
+static float ShooterInfluenceHalfLife = 4.0f;
+FAutoConsoleVariableRef CVarShooterInfluenceHalfLife(
+	TEXT("ShooterInfluence.HalfLife"),
+	ShooterInfluenceHalfLife,
+	TEXT("Time (s) for team influence to drop to half."),
+	ECVF_Default);
+
+static float ShooterInfluenceStampInterval = 0.25f;
+FAutoConsoleVariableRef CVarShooterInfluenceStampInterval(
+	TEXT("ShooterInfluence.StampInterval"),
+	ShooterInfluenceStampInterval,
+	TEXT("How often (s) pawn positions are added to team influence."),
+	ECVF_Default);
+
+static float ShooterInfluencePositionWeight = 1.0f;
+FAutoConsoleVariableRef CVarShooterInfluencePositionWeight(
+	TEXT("ShooterInfluence.PositionWeight"),
+	ShooterInfluencePositionWeight,
+	TEXT("Influence added by a pawn standing in cell, per stamp."),
+	ECVF_Default);
+
+static float ShooterInfluenceFireWeight = 0.5f;
+FAutoConsoleVariableRef CVarShooterInfluenceFireWeight(
+	TEXT("ShooterInfluence.FireWeight"),
+	ShooterInfluenceFireWeight,
+	TEXT("Influence added by a single shot at shooter's location."),
+	ECVF_Default);
+
+FShooterTeamInfluenceMap::FShooterTeamInfluenceMap()
+	: CellSize(800.0f)
+	, TimeToPositionStamp(0.0f)
+{
+}
+
+void FShooterTeamInfluenceMap::Initialize(UWorld* InWorld)
+{
+	World = InWorld;
+	Reset();
+}
+
+void FShooterTeamInfluenceMap::Reset()
+{
+	Cells.Reset();
+	OwnCells.Reset();
+	TimeToPositionStamp = 0.0f;
+}
+
+FIntPoint FShooterTeamInfluenceMap::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+int32 FShooterTeamInfluenceMap::GetLayer(int32 TeamNum) const
+{
+	return FMath::Clamp(TeamNum, 0, (int32)MaxTeams - 1);
+}
+
+float FShooterTeamInfluenceMap::GetTime() const
+{
+	UWorld* MyWorld = World.Get();
+	return MyWorld ? MyWorld->GetTimeSeconds() : 0.0f;
+}
+
+bool FShooterTeamInfluenceMap::IsFreeForAll() const
+{
+	UWorld* MyWorld = World.Get();
+	AShooterGameState* const MyGameState = MyWorld ? MyWorld->GetGameState<AShooterGameState>() : NULL;
+	return MyGameState == NULL || MyGameState->NumTeams <= 1;
+}
+
+float FShooterTeamInfluenceMap::GetDecay(float LastUpdateTime) const
+{
+	return FMath::Pow(2.0f, -(GetTime() - LastUpdateTime) / FMath::Max(ShooterInfluenceHalfLife, 0.1f));
+}
+
+void FShooterTeamInfluenceMap::GetDecayedInfluence(const FCell& Cell, float OutInfluence[MaxTeams]) const
+{
+	const float Decay = GetDecay(Cell.LastUpdateTime);
+	for (int32 Layer = 0; Layer < MaxTeams; Layer++)
+	{
+		OutInfluence[Layer] = Cell.Influence[Layer] * Decay;
+	}
+}
+
+void FShooterTeamInfluenceMap::Tick(float DeltaSeconds)
+{
+	UWorld* MyWorld = World.Get();
+	if (MyWorld == NULL)
+	{
+		return;
+	}
+
+	TimeToPositionStamp -= DeltaSeconds;
+	if (TimeToPositionStamp > 0.0f)
+	{
+		return;
+	}
+
+	TimeToPositionStamp = FMath::Max(ShooterInfluenceStampInterval, 0.05f);
+
+	// forget players who left
+	for (auto It = OwnCells.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (AShooterCharacter* Pawn : TActorRange<AShooterCharacter>(MyWorld))
+	{
+		if (Pawn->IsAlive())
+		{
+			AShooterPlayerState* PlayerState = Cast<AShooterPlayerState>(Pawn->GetPlayerState());
+			AddInfluence(Pawn->GetActorLocation(), PlayerState ? PlayerState->GetTeamNum() : 0, ShooterInfluencePositionWeight, PlayerState);
+		}
+	}
+}
+
+void FShooterTeamInfluenceMap::NotifyWeaponFired(const AShooterCharacter* Shooter)
+{
+	if (Shooter)
+	{
+		AShooterPlayerState* PlayerState = Cast<AShooterPlayerState>(Shooter->GetPlayerState());
+		AddInfluence(Shooter->GetActorLocation(), PlayerState ? PlayerState->GetTeamNum() : 0, ShooterInfluenceFireWeight, PlayerState);
+	}
+}
+
+void FShooterTeamInfluenceMap::AddInfluence(const FVector& Location, int32 TeamNum, float Amount, const AShooterPlayerState* Owner)
+{
+	const FIntPoint Center = GetCell(Location);
+	const int32 Layer = GetLayer(TeamNum);
+	const float Now = GetTime();
+
+	// everyone shares layer 0 in free for all, keep owner's part so it's not counted as enemy to himself
+	TMap<FIntPoint, FOwnCell>* OwnerCells = (Owner && IsFreeForAll()) ? &OwnCells.FindOrAdd(Owner) : NULL;
+
+	for (int32 X = -1; X <= 1; X++)
+	{
+		for (int32 Y = -1; Y <= 1; Y++)
+		{
+			FCell* Cell = Cells.Find(Center + FIntPoint(X, Y));
+			if (Cell == NULL)
+			{
+				Cell = &Cells.Add(Center + FIntPoint(X, Y));
+				FMemory::Memzero(Cell->Influence);
+				Cell->LastUpdateTime = Now;
+			}
+
+			// bring cell to current time before adding, so a single timestamp per cell is enough
+			GetDecayedInfluence(*Cell, Cell->Influence);
+			Cell->LastUpdateTime = Now;
+			Cell->Influence[Layer] += (X == 0 && Y == 0) ? Amount : Amount * 0.5f;
+
+			if (OwnerCells)
+			{
+				FOwnCell* OwnCell = OwnerCells->Find(Center + FIntPoint(X, Y));
+				if (OwnCell == NULL)
+				{
+					OwnCell = &OwnerCells->Add(Center + FIntPoint(X, Y));
+					OwnCell->Influence = 0.0f;
+					OwnCell->LastUpdateTime = Now;
+				}
+
+				OwnCell->Influence = OwnCell->Influence * GetDecay(OwnCell->LastUpdateTime) + ((X == 0 && Y == 0) ? Amount : Amount * 0.5f);
+				OwnCell->LastUpdateTime = Now;
+			}
+		}
+	}
+}
+
+float FShooterTeamInfluenceMap::GetInfluence(const FVector& Location, int32 TeamNum) const
+{
+	const FCell* Cell = Cells.Find(GetCell(Location));
+	if (Cell == NULL)
+	{
+		return 0.0f;
+	}
+
+	float Influence[MaxTeams];
+	GetDecayedInfluence(*Cell, Influence);
+	return Influence[GetLayer(TeamNum)];
+}
+
+float FShooterTeamInfluenceMap::GetOwnInfluence(const FVector& Location, const AShooterPlayerState* PlayerState) const
+{
+	const TMap<FIntPoint, FOwnCell>* PlayerCells = PlayerState ? OwnCells.Find(PlayerState) : NULL;
+	const FOwnCell* OwnCell = PlayerCells ? PlayerCells->Find(GetCell(Location)) : NULL;
+
+	return OwnCell ? OwnCell->Influence * GetDecay(OwnCell->LastUpdateTime) : 0.0f;
+}
+
+float FShooterTeamInfluenceMap::GetEnemyInfluence(const FVector& Location, int32 TeamNum, const AShooterPlayerState* Requester) const
+{
+	const FCell* Cell = Cells.Find(GetCell(Location));
+	if (Cell == NULL)
+	{
+		return 0.0f;
+	}
+
+	float Influence[MaxTeams];
+	GetDecayedInfluence(*Cell, Influence);
+
+	if (IsFreeForAll())
+	{
+		// free for all, everyone but requester is enemy
+		return FMath::Max(Influence[0] - GetOwnInfluence(Location, Requester), 0.0f);
+	}
+
+	UWorld* MyWorld = World.Get();
+	AShooterGameState* const MyGameState = MyWorld ? MyWorld->GetGameState<AShooterGameState>() : NULL;
+	const int32 NumTeams = FMath::Min(MyGameState->NumTeams, (int32)MaxTeams);
+
+	const int32 MyLayer = GetLayer(TeamNum);
+	float EnemyInfluence = 0.0f;
+	for (int32 Layer = 0; Layer < NumTeams; Layer++)
+	{
+		if (Layer != MyLayer)
+		{
+			EnemyInfluence += Influence[Layer];
+		}
+	}
+
+	return EnemyInfluence;
+}
+
+bool FShooterTeamInfluenceMap::FindLocationNear(const FVector& Origin, float Radius, int32 TeamNum, bool bAdvance, FVector& OutLocation, const AShooterPlayerState* Requester) const
+{
+	const bool bFreeForAll = IsFreeForAll();
+
+	const FIntPoint MinCell = GetCell(Origin - FVector(Radius, Radius, 0.0f));
+	const FIntPoint MaxCell = GetCell(Origin + FVector(Radius, Radius, 0.0f));
+	const float RadiusSq = FMath::Square(Radius);
+
+	bool bFound = false;
+	float BestScore = -MAX_FLT;
+	for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+		{
+			// only visited cells, unvisited ones are likely outside of playable area
+			if (!Cells.Contains(FIntPoint(X, Y)))
+			{
+				continue;
+			}
+
+			const FVector CellCenter((X + 0.5f) * CellSize, (Y + 0.5f) * CellSize, Origin.Z);
+			if ((CellCenter - Origin).SizeSquared2D() > RadiusSq)
+			{
+				continue;
+			}
+
+			const float Enemy = GetEnemyInfluence(CellCenter, TeamNum, Requester);
+			const float Own = bFreeForAll ? GetOwnInfluence(CellCenter, Requester) : GetInfluence(CellCenter, TeamNum);
+			if (bAdvance && Enemy <= KINDA_SMALL_NUMBER)
+			{
+				continue;
+			}
+
+			// advance: front line held by own team, retreat: away from enemies, close to friends
+			const float Score = bAdvance ? Own - Enemy : Own * 0.25f - Enemy;
+			if (Score > BestScore)
+			{
+				BestScore = Score;
+				OutLocation = CellCenter;
+				bFound = true;
+			}
+		}
+	}
+
+	return bFound;
+}
@@ -0,0 +1,224 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Online/ShooterTickRateGovernor.h"
+#include "Online/ShooterReplicationGraph.h"
+#include "Bots/ShooterAIController.h"
+
+static int32 ShooterTickRateGovernor = 1;
+FAutoConsoleVariableRef CVarShooterTickRateGovernor(
+	TEXT("ShooterTickRate.Governor"),
+	ShooterTickRateGovernor,
+	TEXT("Adjust tick rate of dedicated server by measured frame time.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+static int32 ShooterTickRateMin = 15;
+FAutoConsoleVariableRef CVarShooterTickRateMin(
+	TEXT("ShooterTickRate.Min"),
+	ShooterTickRateMin,
+	TEXT("Lowest tick rate governor may set."),
+	ECVF_Default);
+
+static int32 ShooterTickRateMax = 0;
+FAutoConsoleVariableRef CVarShooterTickRateMax(
+	TEXT("ShooterTickRate.Max"),
+	ShooterTickRateMax,
+	TEXT("Highest tick rate governor may set, 0 uses NetServerMaxTickRate from config."),
+	ECVF_Default);
+
+static int32 ShooterTickRateStep = 5;
+FAutoConsoleVariableRef CVarShooterTickRateStep(
+	TEXT("ShooterTickRate.Step"),
+	ShooterTickRateStep,
+	TEXT("Tick rate change per adjustment."),
+	ECVF_Default);
+
+static float ShooterTickRateInterval = 2.0f;
+FAutoConsoleVariableRef CVarShooterTickRateInterval(
+	TEXT("ShooterTickRate.Interval"),
+	ShooterTickRateInterval,
+	TEXT("Time (s) frames are measured before tick rate is adjusted."),
+	ECVF_Default);
+
+static float ShooterTickRateOverload = 0.9f;
+FAutoConsoleVariableRef CVarShooterTickRateOverload(
+	TEXT("ShooterTickRate.Overload"),
+	ShooterTickRateOverload,
+	TEXT("Part of frame budget 90th percentile of frame work time may use before tick rate is lowered."),
+	ECVF_Default);
+
+static float ShooterTickRateHeadroom = 0.6f;
+FAutoConsoleVariableRef CVarShooterTickRateHeadroom(
+	TEXT("ShooterTickRate.Headroom"),
+	ShooterTickRateHeadroom,
+	TEXT("Part of frame budget of higher tick rate 90th percentile of frame work time must stay below for tick rate to be raised."),
+	ECVF_Default);
+
+static int32 ShooterTickRateRaiseIntervals = 3;
+FAutoConsoleVariableRef CVarShooterTickRateRaiseIntervals(
+	TEXT("ShooterTickRate.RaiseIntervals"),
+	ShooterTickRateRaiseIntervals,
+	TEXT("Intervals in a row with headroom before tick rate is raised."),
+	ECVF_Default);
+
+FAutoConsoleCommandWithWorldAndArgs ShooterTickRateSetCmd(TEXT("ShooterTickRate.Set"), TEXT("Prints server tick rate and governor changes, sets tick rate when given"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		FShooterTickRateGovernor* Governor = FShooterTickRateGovernor::Get(World);
+		if (Governor == NULL)
+		{
+			return;
+		}
+
+		int32 NewTickRate = 0;
+		if (Args.Num() > 0 && LexTryParseString<int32>(NewTickRate, *Args[0]))
+		{
+			Governor->SetTickRate(NewTickRate);
+		}
+
+		UE_LOG(LogShooter, Display, TEXT("Server tick rate %d Hz (configured %d Hz), governor raised %d and lowered %d times"),
+			Governor->GetTickRate(), Governor->GetConfiguredTickRate(), Governor->NumRaised, Governor->NumLowered);
+	})
+);
+
+FShooterTickRateGovernor::FShooterTickRateGovernor()
+	: WindowStartSeconds(0.0)
+	, WindowNumPlayers(0)
+	, NumHeadroomWindows(0)
+{
+	ResetStats();
+}
+
+void FShooterTickRateGovernor::Initialize(UWorld* InWorld)
+{
+	World = InWorld;
+	ResetWindow(0);
+}
+
+FShooterTickRateGovernor* FShooterTickRateGovernor::Get(const UObject* WorldContextObject)
+{
+	UWorld* MyWorld = WorldContextObject ? WorldContextObject->GetWorld() : NULL;
+	AShooterGameMode* GameMode = MyWorld ? MyWorld->GetAuthGameMode<AShooterGameMode>() : NULL;
+	return GameMode ? &GameMode->GetTickRateGovernor() : NULL;
+}
+
+void FShooterTickRateGovernor::ResetStats()
+{
+	NumRaised = 0;
+	NumLowered = 0;
+}
+
+int32 FShooterTickRateGovernor::GetTickRate() const
+{
+	UWorld* MyWorld = World.Get();
+	UNetDriver* NetDriver = MyWorld ? MyWorld->GetNetDriver() : NULL;
+	return NetDriver ? NetDriver->NetServerMaxTickRate : 0;
+}
+
+int32 FShooterTickRateGovernor::GetConfiguredTickRate() const
+{
+	// net driver survives seamless travel with governed rate, config value is on its class default object
+	UWorld* MyWorld = World.Get();
+	UNetDriver* NetDriver = MyWorld ? MyWorld->GetNetDriver() : NULL;
+	return NetDriver ? NetDriver->GetClass()->GetDefaultObject<UNetDriver>()->NetServerMaxTickRate : 0;
+}
+
+void FShooterTickRateGovernor::ResetWindow(int32 NumPlayers)
+{
+	WorkSamples.Reset();
+	WindowStartSeconds = FPlatformTime::Seconds();
+	WindowNumPlayers = NumPlayers;
+}
+
+void FShooterTickRateGovernor::Tick()
+{
+	UWorld* MyWorld = World.Get();
+	UNetDriver* NetDriver = MyWorld ? MyWorld->GetNetDriver() : NULL;
+	if (ShooterTickRateGovernor <= 0 || NetDriver == NULL || MyWorld->GetNetMode() != NM_DedicatedServer)
+	{
+		return;
+	}
+
+	// players add work to every frame, measurements from before they joined or left don't apply
+	AGameStateBase* const GameState = MyWorld->GetGameState();
+	const int32 NumPlayers = GameState ? GameState->PlayerArray.Num() : 0;
+	if (NumPlayers != WindowNumPlayers)
+	{
+		NumHeadroomWindows = 0;
+		ResetWindow(NumPlayers);
+		return;
+	}
+
+	WorkSamples.AddFrame();
+
+	if (FPlatformTime::Seconds() - WindowStartSeconds < ShooterTickRateInterval)
+	{
+		return;
+	}
+
+	WorkSamples.Sort();
+	const float WorkTime = WorkSamples.GetPercentile(0.9f);
+
+	const int32 TickRate = NetDriver->NetServerMaxTickRate;
+	const int32 MinTickRate = FMath::Max(ShooterTickRateMin, 1);
+	const int32 MaxTickRate = FMath::Max(ShooterTickRateMax > 0 ? ShooterTickRateMax : GetConfiguredTickRate(), MinTickRate);
+	const int32 Step = FMath::Max(ShooterTickRateStep, 1);
+
+	if (TickRate > MinTickRate && WorkTime > ShooterTickRateOverload * 1000.0f / TickRate)
+	{
+		NumHeadroomWindows = 0;
+		NumLowered++;
+		UE_LOG(LogShooter, Log, TEXT("Server overloaded: %.2f ms frame work at %d Hz with %d players, lowering tick rate"), WorkTime, TickRate, NumPlayers);
+		SetTickRate(TickRate - Step);
+	}
+	else if (TickRate < MaxTickRate && WorkTime < ShooterTickRateHeadroom * 1000.0f / FMath::Min(TickRate + Step, MaxTickRate))
+	{
+		NumHeadroomWindows++;
+		if (NumHeadroomWindows >= ShooterTickRateRaiseIntervals)
+		{
+			NumHeadroomWindows = 0;
+			NumRaised++;
+			UE_LOG(LogShooter, Log, TEXT("Server has headroom: %.2f ms frame work at %d Hz with %d players, raising tick rate"), WorkTime, TickRate, NumPlayers);
+			SetTickRate(TickRate + Step);
+		}
+	}
+	else
+	{
+		NumHeadroomWindows = 0;
+	}
+
+	ResetWindow(NumPlayers);
+}
+
+void FShooterTickRateGovernor::SetTickRate(int32 NewTickRate)
+{
+	UWorld* MyWorld = World.Get();
+	UNetDriver* NetDriver = MyWorld ? MyWorld->GetNetDriver() : NULL;
+	if (NetDriver == NULL)
+	{
+		return;
+	}
+
+	const int32 MinTickRate = FMath::Max(ShooterTickRateMin, 1);
+	const int32 MaxTickRate = FMath::Max(ShooterTickRateMax > 0 ? ShooterTickRateMax : GetConfiguredTickRate(), MinTickRate);
+	NewTickRate = FMath::Clamp(NewTickRate, MinTickRate, MaxTickRate);
+	if (NewTickRate == NetDriver->NetServerMaxTickRate)
+	{
+		return;
+	}
+
+	UE_LOG(LogShooter, Log, TEXT("Server tick rate %d -> %d Hz"), NetDriver->NetServerMaxTickRate, NewTickRate);
+	NetDriver->NetServerMaxTickRate = NewTickRate;
+
+	UShooterReplicationGraph* ReplicationGraph = Cast<UShooterReplicationGraph>(NetDriver->GetReplicationDriver());
+	if (ReplicationGraph)
+	{
+		ReplicationGraph->OnServerTickRateChanged(NewTickRate);
+	}
+
+	for (TActorIterator<AShooterAIController> It(MyWorld); It; ++It)
+	{
+		It->UpdateThinkInterval();
+	}
+}
@@ -108,7 +108,7 @@ void AShooterPickup::OnPickedUp()
 
 	if (PickupSound && PickedUpBy)
 	{
-		UGameplayStatics::SpawnSoundAttached(PickupSound, PickedUpBy->GetRootComponent());
+		FShooterAudioManager::SpawnSoundAttached(EShooterSoundCategory::Player, PickupSound, PickedUpBy->GetRootComponent());
 	}
 
 	OnPickedUpEvent();
@@ -129,7 +129,7 @@ void AShooterPickup::OnRespawned()
 	const bool bJustSpawned = CreationTime <= (GetWorld()->GetTimeSeconds() + 5.0f);
 	if (RespawnSound && !bJustSpawned)
 	{
-		UGameplayStatics::PlaySoundAtLocation(this, RespawnSound, GetActorLocation());
+		FShooterAudioManager::PlaySoundAtLocation(this, EShooterSoundCategory::Player, RespawnSound, GetActorLocation());
 	}
 
 	OnRespawnEvent();
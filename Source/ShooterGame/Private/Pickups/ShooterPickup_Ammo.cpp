@@ -34,6 +34,13 @@ void AShooterPickup_Ammo::GivePickupTo(class AShooterCharacter* Pawn)
 		int32 Qty = AmmoClips * Weapon->GetAmmoPerClip();
 		Weapon->GiveAmmo(Qty);
 
+		FShooterCombatRecorder* CombatRecorder = FShooterCombatRecorder::Get(this);
+		if (CombatRecorder)
+		{
+			CombatRecorder->Record(EShooterCombatEvent::Pickup, FShooterCombatRecorder::GetInstigatorFlags(Pawn->Controller), EShooterCombatPickup::Ammo,
+				FShooterCombatRecorder::GetPlayerId(Pawn), INDEX_NONE, (float)Qty, Pawn->GetActorLocation());
+		}
+
 		// Fire event for collected ammo
 		if (Pawn)
 		{
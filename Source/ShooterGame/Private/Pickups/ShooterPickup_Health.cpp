@@ -19,6 +19,14 @@ void AShooterPickup_Health::GivePickupTo(class AShooterCharacter* Pawn)
 	if (Pawn)
 	{
 		Pawn->Health = FMath::Min(FMath::TruncToInt(Pawn->Health) + Health, Pawn->GetMaxHealth());
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterCharacter, Health, Pawn);
+
+		FShooterCombatRecorder* CombatRecorder = FShooterCombatRecorder::Get(this);
+		if (CombatRecorder)
+		{
+			CombatRecorder->Record(EShooterCombatEvent::Pickup, FShooterCombatRecorder::GetInstigatorFlags(Pawn->Controller), EShooterCombatPickup::Health,
+				FShooterCombatRecorder::GetPlayerId(Pawn), INDEX_NONE, (float)Health, Pawn->GetActorLocation());
+		}
 
 		// Fire event for collected health
 		const UWorld* World = GetWorld();
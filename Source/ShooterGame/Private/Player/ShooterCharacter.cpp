@@ -12,6 +12,9 @@
 
 #include "KevinGiang/ShooterGameGrenade.h"
 
+DECLARE_CYCLE_STAT(TEXT("Character Tick"), STAT_ShooterCharacterTick, STATGROUP_ShooterGame);
+DECLARE_CYCLE_STAT(TEXT("Character Take Damage"), STAT_ShooterCharacterTakeDamage, STATGROUP_ShooterGame);
+
 static int32 NetVisualizeRelevancyTestPoints = 0;
 FAutoConsoleVariableRef CVarNetVisualizeRelevancyTestPoints(
 	TEXT("p.NetVisualizeRelevancyTestPoints"),
@@ -33,7 +36,8 @@ FOnShooterCharacterEquipWeapon AShooterCharacter::NotifyEquipWeapon;
 FOnShooterCharacterUnEquipWeapon AShooterCharacter::NotifyUnEquipWeapon;
 
 AShooterCharacter::AShooterCharacter(const FObjectInitializer& ObjectInitializer)
-	: Super(ObjectInitializer.SetDefaultSubobjectClass<UShooterCharacterMovement>(ACharacter::CharacterMovementComponentName))
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UShooterCharacterMovement>(ACharacter::CharacterMovementComponentName)
+		.SetDefaultSubobjectClass<UShooterCharacterMesh>(ACharacter::MeshComponentName))
 {
 	Mesh1P = ObjectInitializer.CreateDefaultSubobject<USkeletalMeshComponent>(this, TEXT("PawnMesh1P"));
 	Mesh1P->SetupAttachment(GetCapsuleComponent());
@@ -65,6 +69,8 @@ AShooterCharacter::AShooterCharacter(const FObjectInitializer& ObjectInitializer
 	bIsTargeting = false;
 	RunningSpeedModifier = 1.5f;
 	bWantsToRun = false;
+	NextRunLoopRequestTime = 0.0f;
+	NextLowHealthRequestTime = 0.0f;
 	bWantsToFire = false;
 	LowHealthPercentage = 0.5f;
 
@@ -73,6 +79,10 @@ AShooterCharacter::AShooterCharacter(const FObjectInitializer& ObjectInitializer
 
     LaunchGrenadeInputActionName = "Grenade";
     GrenadeTossStrength = 500.0f;
+    GrenadeMaxOriginError = 200.0f;
+    GrenadeThrowInterval = 1.0f;
+    LastGrenadeThrowId = 0;
+    LastGrenadeThrowTime = -MAX_FLT;
     GrenadeSpawnLocationComponent = ObjectInitializer.CreateDefaultSubobject<USceneComponent>(this, TEXT("GrenadeSpawnLocationComponent"));
     GrenadeSpawnLocationComponent->SetupAttachment(GetRootComponent());
     GrenadeSpawnLocationComponent->SetRelativeTransform(FTransform::Identity);
@@ -80,14 +90,23 @@ AShooterCharacter::AShooterCharacter(const FObjectInitializer& ObjectInitializer
 
 void AShooterCharacter::PostInitializeComponents()
 {
+	SHOOTER_LLM_SCOPE(Characters);
+
 	Super::PostInitializeComponents();
 
 	if (GetLocalRole() == ROLE_Authority)
 	{
 		Health = GetMaxHealth();
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterCharacter, Health, this);
 
 		// Needs to happen after character is added to repgraph
 		GetWorldTimerManager().SetTimerForNextTick(this, &AShooterCharacter::SpawnDefaultInventory);
+
+		FShooterProjectilePool* Pool = FShooterProjectilePool::Get(this);
+		if (Pool)
+		{
+			Pool->Prewarm(ShooterGameGrenadeClass);
+		}
 	}
 
 	// set initial mesh visibility (3rd person view)
@@ -109,7 +128,7 @@ void AShooterCharacter::PostInitializeComponents()
 
 		if (RespawnSound)
 		{
-			UGameplayStatics::PlaySoundAtLocation(this, RespawnSound, GetActorLocation());
+			FShooterAudioManager::PlaySoundAtLocation(this, EShooterSoundCategory::Player, RespawnSound, GetActorLocation());
 		}
 	}
 }
@@ -196,7 +215,15 @@ void AShooterCharacter::UpdatePawnMeshes()
 	Mesh1P->VisibilityBasedAnimTickOption = !bFirstPerson ? EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered : EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
 	Mesh1P->SetOwnerNoSee(!bFirstPerson);
 
-	GetMesh()->VisibilityBasedAnimTickOption = bFirstPerson ? EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered : EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+	UShooterCharacterMesh* Mesh3P = Cast<UShooterCharacterMesh>(GetMesh());
+	if (Mesh3P)
+	{
+		Mesh3P->SetRemoteAnimationLOD(!IsLocallyControlled());
+	}
+	if (bFirstPerson || Mesh3P == NULL)
+	{
+		GetMesh()->VisibilityBasedAnimTickOption = bFirstPerson ? EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered : EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+	}
 	GetMesh()->SetOwnerNoSee(bFirstPerson);
 }
 
@@ -265,6 +292,8 @@ void AShooterCharacter::KilledBy(APawn* EventInstigator)
 
 float AShooterCharacter::TakeDamage(float Damage, struct FDamageEvent const& DamageEvent, class AController* EventInstigator, class AActor* DamageCauser)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterCharacterTakeDamage, ShooterCharacters, TakeDamage);
+
 	AShooterPlayerController* MyPC = Cast<AShooterPlayerController>(Controller);
 	if (MyPC && MyPC->HasGodMode())
 	{
@@ -284,6 +313,16 @@ float AShooterCharacter::TakeDamage(float Damage, struct FDamageEvent const& Dam
 	if (ActualDamage > 0.f)
 	{
 		Health -= ActualDamage;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterCharacter, Health, this);
+
+		FShooterCombatRecorder* CombatRecorder = FShooterCombatRecorder::Get(this);
+		if (CombatRecorder)
+		{
+			uint8 Flags = FShooterCombatRecorder::GetInstigatorFlags(EventInstigator);
+			Flags |= DamageEvent.IsOfType(FRadialDamageEvent::ClassID) ? EShooterCombatEventFlags::Radial : 0;
+			Flags |= Health <= 0 ? EShooterCombatEventFlags::Lethal : 0;
+			CombatRecorder->Record(EShooterCombatEvent::Hit, Flags, 0, FShooterCombatRecorder::GetPlayerId(EventInstigator), FShooterCombatRecorder::GetPlayerId(this), ActualDamage, GetActorLocation());
+		}
 		if (Health <= 0)
 		{
 			Die(ActualDamage, DamageEvent, EventInstigator, DamageCauser);
@@ -323,6 +362,7 @@ bool AShooterCharacter::Die(float KillingDamage, FDamageEvent const& DamageEvent
 	}
 
 	Health = FMath::Min(0.0f, Health);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterCharacter, Health, this);
 
 	// if this is an environmental death then refer to the previous killer so that they receive credit (knocked into lava pits, etc)
 	UDamageType const* const DamageType = DamageEvent.DamageTypeClass ? DamageEvent.DamageTypeClass->GetDefaultObject<UDamageType>() : GetDefault<UDamageType>();
@@ -371,7 +411,7 @@ void AShooterCharacter::OnDeath(float KillingDamage, struct FDamageEvent const&
 	// cannot use IsLocallyControlled here, because even local client's controller may be NULL here
 	if (GetNetMode() != NM_DedicatedServer && DeathSound && Mesh1P && Mesh1P->IsVisible())
 	{
-		UGameplayStatics::PlaySoundAtLocation(this, DeathSound, GetActorLocation());
+		FShooterAudioManager::PlaySoundAtLocation(this, EShooterSoundCategory::Player, DeathSound, GetActorLocation());
 	}
 
 	// remove all weapons
@@ -383,15 +423,8 @@ void AShooterCharacter::OnDeath(float KillingDamage, struct FDamageEvent const&
 	DetachFromControllerPendingDestroy();
 	StopAllAnimMontages();
 
-	if (LowHealthWarningPlayer && LowHealthWarningPlayer->IsPlaying())
-	{
-		LowHealthWarningPlayer->Stop();
-	}
-
-	if (RunLoopAC)
-	{
-		RunLoopAC->Stop();
-	}
+	FShooterAudioManager::StopSound(LowHealthWarningPlayer);
+	FShooterAudioManager::StopSound(RunLoopAC);
 
 	if (GetMesh())
 	{
@@ -474,15 +507,28 @@ void AShooterCharacter::PlayHit(float DamageTaken, struct FDamageEvent const& Da
 void AShooterCharacter::SetRagdollPhysics()
 {
 	bool bInRagdoll = false;
+	bool bHoldDeathPose = false;
 
+	FShooterRagdollManager* RagdollManager = FShooterRagdollManager::Get(this);
 	if (IsPendingKill())
 	{
 		bInRagdoll = false;
 	}
+	else if (GetNetMode() == NM_DedicatedServer)
+	{
+		// nobody sees corpses here, keep the actor only for clients to show theirs
+		FShooterRagdollManager::FreezePose(GetMesh());
+		bHoldDeathPose = true;
+	}
 	else if (!GetMesh() || !GetMesh()->GetPhysicsAsset())
 	{
 		bInRagdoll = false;
 	}
+	else if (RagdollManager && !RagdollManager->RequestRagdoll(this))
+	{
+		// over budget, far or off screen: let death animation finish and stay in its last pose, hidden without one
+		bHoldDeathPose = StartDeathPoseHold();
+	}
 	else
 	{
 		// initialize physics/etc
@@ -497,7 +543,7 @@ void AShooterCharacter::SetRagdollPhysics()
 	GetCharacterMovement()->DisableMovement();
 	GetCharacterMovement()->SetComponentTickEnabled(false);
 
-	if (!bInRagdoll)
+	if (!bInRagdoll && !bHoldDeathPose)
 	{
 		// hide and set short lifespan
 		TurnOff();
@@ -510,6 +556,45 @@ void AShooterCharacter::SetRagdollPhysics()
 	}
 }
 
+/** time before end of montage to pause it at, so auto blend out doesn't start first */
+static const float DeathPoseHoldMargin = 0.05f;
+
+bool AShooterCharacter::StartDeathPoseHold()
+{
+	UAnimInstance* AnimInstance = GetMesh() ? GetMesh()->GetAnimInstance() : NULL;
+	if (DeathAnim == NULL || AnimInstance == NULL || !AnimInstance->Montage_IsPlaying(DeathAnim))
+	{
+		return false;
+	}
+
+	const float HoldPosition = FMath::Max(DeathAnim->GetPlayLength() - DeathAnim->BlendOut.GetBlendTime() - DeathPoseHoldMargin, 0.0f);
+	const float TimeToHold = (HoldPosition - AnimInstance->Montage_GetPosition(DeathAnim)) / FMath::Max(DeathAnim->RateScale, KINDA_SMALL_NUMBER);
+
+	FTimerHandle TimerHandle;
+	GetWorldTimerManager().SetTimer(TimerHandle, this, &AShooterCharacter::HoldDeathPose, FMath::Max(TimeToHold, 0.01f), false);
+	return true;
+}
+
+void AShooterCharacter::HoldDeathPose()
+{
+	UAnimInstance* AnimInstance = GetMesh() ? GetMesh()->GetAnimInstance() : NULL;
+	if (DeathAnim && AnimInstance && AnimInstance->Montage_IsPlaying(DeathAnim))
+	{
+		// timer may fire a frame late, put it back on the last frame before blend out
+		AnimInstance->Montage_Pause(DeathAnim);
+		AnimInstance->Montage_SetPosition(DeathAnim, FMath::Max(DeathAnim->GetPlayLength() - DeathAnim->BlendOut.GetBlendTime() - DeathPoseHoldMargin, 0.0f));
+	}
+
+	// give the mesh a moment to evaluate held pose before its update is stopped
+	FTimerHandle TimerHandle;
+	GetWorldTimerManager().SetTimer(TimerHandle, this, &AShooterCharacter::FreezeDeathPose, 0.1f, false);
+}
+
+void AShooterCharacter::FreezeDeathPose()
+{
+	FShooterRagdollManager::FreezePose(GetMesh());
+}
+
 
 
 void AShooterCharacter::ReplicateHit(float Damage, struct FDamageEvent const& DamageEvent, class APawn* PawnInstigator, class AActor* DamageCauser, bool bKilled)
@@ -536,6 +621,7 @@ void AShooterCharacter::ReplicateHit(float Damage, struct FDamageEvent const& Da
 	LastTakeHitInfo.SetDamageEvent(DamageEvent);
 	LastTakeHitInfo.bKilled = bKilled;
 	LastTakeHitInfo.EnsureReplication();
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterCharacter, LastTakeHitInfo, this);
 
 	LastTakeHitTimeTimeout = TimeoutTime;
 }
@@ -568,6 +654,8 @@ bool AShooterCharacter::IsMoving()
 
 void AShooterCharacter::SpawnDefaultInventory()
 {
+	SHOOTER_LLM_SCOPE(Weapons);
+
 	if (GetLocalRole() < ROLE_Authority)
 	{
 		return;
@@ -617,6 +705,7 @@ void AShooterCharacter::AddWeapon(AShooterWeapon* Weapon)
 	{
 		Weapon->OnEnterInventory(this);
 		Inventory.AddUnique(Weapon);
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterCharacter, Inventory, this);
 	}
 }
 
@@ -626,6 +715,7 @@ void AShooterCharacter::RemoveWeapon(AShooterWeapon* Weapon)
 	{
 		Weapon->OnLeaveInventory();
 		Inventory.RemoveSingle(Weapon);
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterCharacter, Inventory, this);
 	}
 }
 
@@ -692,6 +782,7 @@ void AShooterCharacter::SetCurrentWeapon(AShooterWeapon* NewWeapon, AShooterWeap
 	}
 
 	CurrentWeapon = NewWeapon;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterCharacter, CurrentWeapon, this);
 
 	// equip new one
 	if (NewWeapon)
@@ -743,28 +834,14 @@ bool AShooterCharacter::CanReload() const
 void AShooterCharacter::SetTargeting(bool bNewTargeting)
 {
 	bIsTargeting = bNewTargeting;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterCharacter, bIsTargeting, this);
 
 	if (TargetingSound)
 	{
-		UGameplayStatics::SpawnSoundAttached(TargetingSound, GetRootComponent());
-	}
-
-	if (GetLocalRole() < ROLE_Authority)
-	{
-		ServerSetTargeting(bNewTargeting);
+		FShooterAudioManager::SpawnSoundAttached(EShooterSoundCategory::Player, TargetingSound, GetRootComponent());
 	}
 }
 
-bool AShooterCharacter::ServerSetTargeting_Validate(bool bNewTargeting)
-{
-	return true;
-}
-
-void AShooterCharacter::ServerSetTargeting_Implementation(bool bNewTargeting)
-{
-	SetTargeting(bNewTargeting);
-}
-
 //////////////////////////////////////////////////////////////////////////
 // Movement
 
@@ -772,50 +849,46 @@ void AShooterCharacter::SetRunning(bool bNewRunning, bool bToggle)
 {
 	bWantsToRun = bNewRunning;
 	bWantsToRunToggled = bNewRunning && bToggle;
-
-	if (GetLocalRole() < ROLE_Authority)
-	{
-		ServerSetRunning(bNewRunning, bToggle);
-	}
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterCharacter, bWantsToRun, this);
 }
 
-bool AShooterCharacter::ServerSetRunning_Validate(bool bNewRunning, bool bToggle)
+void AShooterCharacter::SetMovementModifiers(bool bNewRunning, bool bNewTargeting)
 {
-	return true;
-}
-
-void AShooterCharacter::ServerSetRunning_Implementation(bool bNewRunning, bool bToggle)
-{
-	SetRunning(bNewRunning, bToggle);
+	bWantsToRun = bNewRunning;
+	bIsTargeting = bNewTargeting;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterCharacter, bWantsToRun, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterCharacter, bIsTargeting, this);
 }
 
 void AShooterCharacter::UpdateRunSounds()
 {
-	const bool bIsRunSoundPlaying = RunLoopAC != nullptr && RunLoopAC->IsActive();
+	const bool bIsRunSoundPlaying = RunLoopAC != nullptr && RunLoopAC->IsPlaying();
 	const bool bWantsRunSoundPlaying = IsRunning() && IsMoving();
 
 	// Don't bother playing the sounds unless we're running and moving.
 	if (!bIsRunSoundPlaying && bWantsRunSoundPlaying)
 	{
-		if (RunLoopAC != nullptr)
-		{
-			RunLoopAC->Play();
-		}
-		else if (RunLoopSound != nullptr)
+		// loop may have lost its voice to more important sounds, ask for a new one but not every frame while it's denied
+		const float Now = GetWorld()->GetTimeSeconds();
+		if (RunLoopSound != nullptr && Now >= NextRunLoopRequestTime)
 		{
-			RunLoopAC = UGameplayStatics::SpawnSoundAttached(RunLoopSound, GetRootComponent());
-			if (RunLoopAC != nullptr)
-			{
-				RunLoopAC->bAutoDestroy = false;
-			}
+			FShooterAudioManager::StopSound(RunLoopAC);
+			RunLoopAC = FShooterAudioManager::SpawnSoundAttached(EShooterSoundCategory::Movement, RunLoopSound, GetRootComponent(), true);
+			NextRunLoopRequestTime = Now + 1.0f;
 		}
 	}
-	else if (bIsRunSoundPlaying && !bWantsRunSoundPlaying)
+	else if (!bWantsRunSoundPlaying)
 	{
-		RunLoopAC->Stop();
-		if (RunStopSound != nullptr)
+		// next run starts its loop right away
+		NextRunLoopRequestTime = 0.0f;
+
+		if (RunLoopAC != nullptr)
 		{
-			UGameplayStatics::SpawnSoundAttached(RunStopSound, GetRootComponent());
+			FShooterAudioManager::StopSound(RunLoopAC);
+			if (bIsRunSoundPlaying)
+			{
+				FShooterAudioManager::SpawnSoundAttached(EShooterSoundCategory::Movement, RunStopSound, GetRootComponent());
+			}
 		}
 	}
 }
@@ -1075,11 +1148,13 @@ bool AShooterCharacter::IsRunning() const
 		return false;
 	}
 
-	return (bWantsToRun || bWantsToRunToggled) && !GetVelocity().IsZero() && (GetVelocity().GetSafeNormal2D() | GetActorForwardVector()) > -0.1;
+	return bWantsToRun && !GetVelocity().IsZero() && (GetVelocity().GetSafeNormal2D() | GetActorForwardVector()) > -0.1;
 }
 
 void AShooterCharacter::Tick(float DeltaSeconds)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterCharacterTick, ShooterCharacters, Tick);
+
 	Super::Tick(DeltaSeconds);
 
 	if (bWantsToRunToggled && !IsRunning())
@@ -1096,6 +1171,7 @@ void AShooterCharacter::Tick(float DeltaSeconds)
 			{
 				Health = this->GetMaxHealth();
 			}
+			MARK_PROPERTY_DIRTY_FROM_NAME(AShooterCharacter, Health, this);
 		}
 	}
 
@@ -1105,16 +1181,26 @@ void AShooterCharacter::Tick(float DeltaSeconds)
 		{
 			if ((this->Health > 0 && this->Health < this->GetMaxHealth() * LowHealthPercentage) && (!LowHealthWarningPlayer || !LowHealthWarningPlayer->IsPlaying()))
 			{
-				LowHealthWarningPlayer = UGameplayStatics::SpawnSoundAttached(LowHealthSound, GetRootComponent(),
-					NAME_None, FVector(ForceInit), EAttachLocation::KeepRelativeOffset, true);
-				if (LowHealthWarningPlayer)
+				// same as run loop, a denied or stolen voice is asked for again only after a while
+				const float Now = GetWorld()->GetTimeSeconds();
+				if (Now >= NextLowHealthRequestTime)
 				{
-					LowHealthWarningPlayer->SetVolumeMultiplier(0.0f);
+					FShooterAudioManager::StopSound(LowHealthWarningPlayer);
+					LowHealthWarningPlayer = FShooterAudioManager::SpawnSoundAttached(EShooterSoundCategory::Player, LowHealthSound, GetRootComponent(), true);
+					if (LowHealthWarningPlayer)
+					{
+						LowHealthWarningPlayer->SetVolumeMultiplier(0.0f);
+					}
+					NextLowHealthRequestTime = Now + 1.0f;
 				}
 			}
-			else if ((this->Health > this->GetMaxHealth() * LowHealthPercentage || this->Health < 0) && LowHealthWarningPlayer && LowHealthWarningPlayer->IsPlaying())
+			else if (this->Health > this->GetMaxHealth() * LowHealthPercentage || this->Health < 0)
 			{
-				LowHealthWarningPlayer->Stop();
+				NextLowHealthRequestTime = 0.0f;
+				if (LowHealthWarningPlayer)
+				{
+					FShooterAudioManager::StopSound(LowHealthWarningPlayer);
+				}
 			}
 			if (LowHealthWarningPlayer && LowHealthWarningPlayer->IsPlaying())
 			{
@@ -1191,18 +1277,25 @@ void AShooterCharacter::GetLifetimeReplicatedProps(TArray< FLifetimeProperty > &
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
 	// only to local owner: weapon change requests are locally instigated, other clients don't need it
-	DOREPLIFETIME_CONDITION(AShooterCharacter, Inventory, COND_OwnerOnly);
+	Params.Condition = COND_OwnerOnly;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AShooterCharacter, Inventory, Params);
 
 	// everyone except local owner: flag change is locally instigated
-	DOREPLIFETIME_CONDITION(AShooterCharacter, bIsTargeting, COND_SkipOwner);
-	DOREPLIFETIME_CONDITION(AShooterCharacter, bWantsToRun, COND_SkipOwner);
+	Params.Condition = COND_SkipOwner;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AShooterCharacter, bIsTargeting, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AShooterCharacter, bWantsToRun, Params);
 
-	DOREPLIFETIME_CONDITION(AShooterCharacter, LastTakeHitInfo, COND_Custom);
+	Params.Condition = COND_Custom;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AShooterCharacter, LastTakeHitInfo, Params);
 
 	// everyone
-	DOREPLIFETIME(AShooterCharacter, CurrentWeapon);
-	DOREPLIFETIME(AShooterCharacter, Health);
+	Params.Condition = COND_None;
+	DOREPLIFETIME_WITH_PARAMS_FAST(AShooterCharacter, CurrentWeapon, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(AShooterCharacter, Health, Params);
 }
 
 bool AShooterCharacter::IsReplicationPausedForConnection(const FNetViewer& ConnectionOwnerNetViewer)
@@ -1340,11 +1433,6 @@ void AShooterCharacter::OnLaunchGrenadeInputActionPressed()
 {
     if (GetWorld() && ShooterGameGrenadeClass && GrenadeSpawnLocationComponent)
     {
-        // Set up spawn parameters
-        FActorSpawnParameters SpawnParams;
-        SpawnParams.Owner = this;
-        SpawnParams.Instigator = this;
-
         // Get relative launch rotation so we can get the impulse vector
         FRotator LaunchRotation(
             GetControlRotation().Pitch + GrenadeLaunchPitchAngle, 
@@ -1352,17 +1440,126 @@ void AShooterCharacter::OnLaunchGrenadeInputActionPressed()
             0.0f
         );
 
-        // Get spawn location from the component in the actor
-        FTransform GrenadeSpawnTransform;
-        GrenadeSpawnTransform.SetLocation(GrenadeSpawnLocationComponent->GetComponentLocation());
+        const FVector Origin = GrenadeSpawnLocationComponent->GetComponentLocation();
+        const FVector Direction = LaunchRotation.Vector();
+        const AGameStateBase* GameState = GetWorld()->GetGameState();
+        const float LaunchTime = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+
+        if (!ConsumeGrenadeThrow(GrenadeThrowInterval))
+        {
+            return;
+        }
 
-        // Spawn grenade and then apply impulse on it to launch it forwards from the character
-        if (AShooterGameGrenade* SpawnedGrenade = GetWorld()->SpawnActor<AShooterGameGrenade>(ShooterGameGrenadeClass, GrenadeSpawnTransform, SpawnParams))
+        if (GetLocalRole() == ROLE_Authority)
         {
-            if (UPrimitiveComponent* RootPrimitiveComponent = Cast<UPrimitiveComponent>(SpawnedGrenade->GetRootComponent()))
+            SpawnGrenade(Origin, Direction, LaunchTime, 0, false);
+        }
+        else
+        {
+            // Throw a predicted grenade right away, the server's grenade replaces it when it detonates
+            LastGrenadeThrowId++;
+            if (AShooterGameGrenade* PredictedGrenade = SpawnGrenade(Origin, Direction, LaunchTime, LastGrenadeThrowId, true))
             {
-                RootPrimitiveComponent->AddImpulse(LaunchRotation.Vector() * GrenadeTossStrength);
+                PredictedGrenades.Add(PredictedGrenade);
             }
+
+            ServerLaunchGrenade(Origin, Direction, LaunchTime, LastGrenadeThrowId);
         }
     }
-}
\ No newline at end of file
+}
+
+AShooterGameGrenade* AShooterCharacter::SpawnGrenade(const FVector& Origin, const FVector& Direction, float LaunchTime, uint8 ThrowId, bool bPredicted)
+{
+    FTransform GrenadeSpawnTransform;
+    GrenadeSpawnTransform.SetLocation(Origin);
+
+    // Server grenades are reused, predicted ones only live on the throwing client
+    FShooterProjectilePool* Pool = bPredicted ? nullptr : FShooterProjectilePool::Get(this);
+    if (Pool)
+    {
+        return Pool->SpawnActor<AShooterGameGrenade>(ShooterGameGrenadeClass, GrenadeSpawnTransform, this, this, [&](AShooterGameGrenade* SpawnedGrenade)
+        {
+            SpawnedGrenade->InitLaunch(Origin, Direction, GrenadeTossStrength, LaunchTime, ThrowId, false);
+        });
+    }
+
+    // Deferred so the launch is set up before BeginPlay applies the impulse
+    AShooterGameGrenade* SpawnedGrenade = GetWorld()->SpawnActorDeferred<AShooterGameGrenade>(
+        ShooterGameGrenadeClass, 
+        GrenadeSpawnTransform, 
+        this, 
+        this, 
+        ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+    );
+
+    if (SpawnedGrenade)
+    {
+        SpawnedGrenade->InitLaunch(Origin, Direction, GrenadeTossStrength, LaunchTime, ThrowId, bPredicted);
+        UGameplayStatics::FinishSpawningActor(SpawnedGrenade, GrenadeSpawnTransform);
+    }
+
+    return SpawnedGrenade;
+}
+
+bool AShooterCharacter::ServerLaunchGrenade_Validate(FVector_NetQuantize Origin, FVector_NetQuantizeNormal Direction, float LaunchTime, uint8 ThrowId)
+{
+    return !Origin.ContainsNaN() && !Direction.ContainsNaN() && FMath::IsFinite(LaunchTime);
+}
+
+void AShooterCharacter::ServerLaunchGrenade_Implementation(FVector_NetQuantize Origin, FVector_NetQuantizeNormal Direction, float LaunchTime, uint8 ThrowId)
+{
+    if (!IsAlive() || ShooterGameGrenadeClass == nullptr || GrenadeSpawnLocationComponent == nullptr)
+    {
+        return;
+    }
+
+    // Ids wrap around, anything not ahead of the last accepted throw is a replay or out of order
+    const uint8 ThrowIdDelta = ThrowId - LastGrenadeThrowId;
+    if (ThrowIdDelta == 0 || ThrowIdDelta > 127)
+    {
+        return;
+    }
+
+    // Throws already passed the interval on the client, allow some slack for packets arriving bunched up
+    if (!ConsumeGrenadeThrow(GrenadeThrowInterval * 0.75f))
+    {
+        return;
+    }
+
+    LastGrenadeThrowId = ThrowId;
+
+    // Trust the client's origin only as far as movement correction would
+    const FVector ServerOrigin = GrenadeSpawnLocationComponent->GetComponentLocation();
+    const FVector LaunchOrigin = FVector::DistSquared(Origin, ServerOrigin) <= FMath::Square(GrenadeMaxOriginError) ? FVector(Origin) : ServerOrigin;
+
+    SpawnGrenade(LaunchOrigin, Direction.GetSafeNormal(), LaunchTime, ThrowId, false);
+}
+
+bool AShooterCharacter::ConsumeGrenadeThrow(float MinInterval)
+{
+    const float Now = GetWorld()->GetTimeSeconds();
+    if (Now - LastGrenadeThrowTime < MinInterval)
+    {
+        return false;
+    }
+
+    LastGrenadeThrowTime = Now;
+    return true;
+}
+
+AShooterGameGrenade* AShooterCharacter::TakePredictedGrenade(uint8 ThrowId)
+{
+    AShooterGameGrenade* Result = nullptr;
+
+    for (int32 Idx = PredictedGrenades.Num() - 1; Idx >= 0; Idx--)
+    {
+        AShooterGameGrenade* PredictedGrenade = PredictedGrenades[Idx].Get();
+        if (PredictedGrenade == nullptr || PredictedGrenade->GetThrowId() == ThrowId)
+        {
+            Result = PredictedGrenade ? PredictedGrenade : Result;
+            PredictedGrenades.RemoveAtSwap(Idx);
+        }
+    }
+
+    return Result;
+}
@@ -0,0 +1,81 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Player/ShooterCharacterMesh.h"
+
+static int32 ShooterAnimLOD = 1;
+FAutoConsoleVariableRef CVarShooterAnimLOD(
+	TEXT("ShooterAnim.LOD"),
+	ShooterAnimLOD,
+	TEXT("Reduce animation update rate of remote pawns by screen size and skip their pose while not rendered. Applied on respawn.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+static float ShooterAnimLODFullScreenSize = 0.4f;
+FAutoConsoleVariableRef CVarShooterAnimLODFullScreenSize(
+	TEXT("ShooterAnim.LODFullScreenSize"),
+	ShooterAnimLODFullScreenSize,
+	TEXT("Remote pawns smaller on screen than this update animation every other frame. Applied on respawn."),
+	ECVF_Default);
+
+static float ShooterAnimLODReducedScreenSize = 0.15f;
+FAutoConsoleVariableRef CVarShooterAnimLODReducedScreenSize(
+	TEXT("ShooterAnim.LODReducedScreenSize"),
+	ShooterAnimLODReducedScreenSize,
+	TEXT("Remote pawns smaller on screen than this update animation every third frame, or less. Applied on respawn."),
+	ECVF_Default);
+
+UShooterCharacterMesh::FAnimLODStats UShooterCharacterMesh::AnimLODStats[EShooterAnimLOD::MAX] = {};
+
+UShooterCharacterMesh::UShooterCharacterMesh(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	bRemoteAnimationLOD = false;
+
+	OnAnimUpdateRateParamsCreated.BindUObject(this, &UShooterCharacterMesh::OnUpdateRateParamsCreated);
+}
+
+void UShooterCharacterMesh::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	FAnimLODStats& Stats = AnimLODStats[GetAnimLOD()];
+	Stats.NumTicks++;
+	Stats.GameThreadTime += FPlatformTime::Seconds() - StartTime;
+}
+
+void UShooterCharacterMesh::SetRemoteAnimationLOD(bool bRemote)
+{
+	bRemoteAnimationLOD = bRemote && ShooterAnimLOD > 0;
+
+	// remote pawns don't need a pose while nobody sees them, montages keep ticking so they're in sync once visible.
+	// Dedicated servers never render, so their pawns only tick montages
+	VisibilityBasedAnimTickOption = bRemoteAnimationLOD ? EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered : EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+	bEnableUpdateRateOptimizations = bRemoteAnimationLOD;
+}
+
+EShooterAnimLOD::Type UShooterCharacterMesh::GetAnimLOD() const
+{
+	if (!bRemoteAnimationLOD)
+	{
+		return EShooterAnimLOD::Local;
+	}
+
+	if (!bRecentlyRendered)
+	{
+		return EShooterAnimLOD::Offscreen;
+	}
+
+	return (AnimUpdateRateParams && AnimUpdateRateParams->UpdateRate > 1) ? EShooterAnimLOD::Reduced : EShooterAnimLOD::Full;
+}
+
+void UShooterCharacterMesh::OnUpdateRateParamsCreated(FAnimUpdateRateParameters* Params)
+{
+	// frames skipped by screen size: above first threshold every frame, then every 2nd, 3rd...
+	Params->BaseVisibleDistanceFactorThesholds.Reset();
+	Params->BaseVisibleDistanceFactorThesholds.Add(ShooterAnimLODFullScreenSize);
+	Params->BaseVisibleDistanceFactorThesholds.Add(ShooterAnimLODReducedScreenSize);
+	Params->bInterpolateSkippedFrames = true;
+}
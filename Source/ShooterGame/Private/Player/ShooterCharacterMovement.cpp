@@ -9,6 +9,11 @@
 UShooterCharacterMovement::UShooterCharacterMovement(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
+	ReducedLODTickInterval = 0.1f;
+	bReducedMovementLOD = false;
+
+	// navmesh walking is only used as movement LOD, keep it cheap
+	bSweepWhileNavWalking = false;
 }
 
 
@@ -31,3 +36,158 @@ float UShooterCharacterMovement::GetMaxSpeed() const
 
 	return MaxSpeed;
 }
+
+void UShooterCharacterMovement::UpdateFromCompressedFlags(uint8 Flags)
+{
+	Super::UpdateFromCompressedFlags(Flags);
+
+	// server applies state sent with each move, replaces separate RPCs
+	AShooterCharacter* ShooterCharacterOwner = Cast<AShooterCharacter>(CharacterOwner);
+	if (ShooterCharacterOwner)
+	{
+		const bool bWantsToRun = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+		const bool bIsTargeting = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+
+		if (bWantsToRun != ShooterCharacterOwner->WantsToRun())
+		{
+			ShooterCharacterOwner->SetRunning(bWantsToRun, false);
+		}
+		if (bIsTargeting != ShooterCharacterOwner->IsTargeting())
+		{
+			ShooterCharacterOwner->SetTargeting(bIsTargeting);
+		}
+	}
+}
+
+FNetworkPredictionData_Client* UShooterCharacterMovement::GetPredictionData_Client() const
+{
+	if (ClientPredictionData == NULL)
+	{
+		UShooterCharacterMovement* MutableThis = const_cast<UShooterCharacterMovement*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_Shooter(*this);
+	}
+
+	return ClientPredictionData;
+}
+
+bool UShooterCharacterMovement::ClientUpdatePositionAfterServerUpdate()
+{
+	// replayed moves restore their own state, put back the current one afterwards
+	AShooterCharacter* ShooterCharacterOwner = Cast<AShooterCharacter>(CharacterOwner);
+	const bool bRealWantsToRun = ShooterCharacterOwner && ShooterCharacterOwner->WantsToRun();
+	const bool bRealIsTargeting = ShooterCharacterOwner && ShooterCharacterOwner->IsTargeting();
+
+	const bool bResult = Super::ClientUpdatePositionAfterServerUpdate();
+
+	if (ShooterCharacterOwner)
+	{
+		ShooterCharacterOwner->SetMovementModifiers(bRealWantsToRun, bRealIsTargeting);
+	}
+
+	return bResult;
+}
+
+void UShooterCharacterMovement::SetReducedMovementLOD(bool bReduced)
+{
+	if (bReduced == bReducedMovementLOD)
+	{
+		return;
+	}
+
+	if (bReduced)
+	{
+		// wait until landed, navmesh walking can't simulate falling
+		if (!IsMovingOnGround())
+		{
+			return;
+		}
+
+		SetMovementMode(MOVE_NavWalking);
+		SetComponentTickInterval(ReducedLODTickInterval);
+	}
+	else
+	{
+		SetComponentTickInterval(0.0f);
+		if (MovementMode == MOVE_NavWalking)
+		{
+			// finds floor and restores collision with world geometry
+			SetMovementMode(MOVE_Walking);
+		}
+	}
+
+	bReducedMovementLOD = bReduced;
+}
+
+//----------------------------------------------------------------------//
+// FSavedMove_Shooter
+//----------------------------------------------------------------------//
+void FSavedMove_Shooter::Clear()
+{
+	Super::Clear();
+
+	bSavedWantsToRun = false;
+	bSavedIsTargeting = false;
+}
+
+uint8 FSavedMove_Shooter::GetCompressedFlags() const
+{
+	uint8 Result = Super::GetCompressedFlags();
+
+	if (bSavedWantsToRun)
+	{
+		Result |= FLAG_Custom_0;
+	}
+	if (bSavedIsTargeting)
+	{
+		Result |= FLAG_Custom_1;
+	}
+
+	return Result;
+}
+
+bool FSavedMove_Shooter::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	const FSavedMove_Shooter* NewShooterMove = static_cast<const FSavedMove_Shooter*>(NewMove.Get());
+	if (bSavedWantsToRun != NewShooterMove->bSavedWantsToRun || bSavedIsTargeting != NewShooterMove->bSavedIsTargeting)
+	{
+		return false;
+	}
+
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_Shooter::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	const AShooterCharacter* ShooterCharacter = Cast<AShooterCharacter>(C);
+	if (ShooterCharacter)
+	{
+		bSavedWantsToRun = ShooterCharacter->WantsToRun();
+		bSavedIsTargeting = ShooterCharacter->IsTargeting();
+	}
+}
+
+void FSavedMove_Shooter::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	AShooterCharacter* ShooterCharacter = Cast<AShooterCharacter>(C);
+	if (ShooterCharacter)
+	{
+		ShooterCharacter->SetMovementModifiers(bSavedWantsToRun, bSavedIsTargeting);
+	}
+}
+
+//----------------------------------------------------------------------//
+// FNetworkPredictionData_Client_Shooter
+//----------------------------------------------------------------------//
+FNetworkPredictionData_Client_Shooter::FNetworkPredictionData_Client_Shooter(const UCharacterMovementComponent& ClientMovement)
+	: Super(ClientMovement)
+{
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_Shooter::AllocateNewMove()
+{
+	return FSavedMovePtr(new FSavedMove_Shooter());
+}
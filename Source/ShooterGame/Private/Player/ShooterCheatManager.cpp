@@ -4,6 +4,8 @@
 #include "Player/ShooterCheatManager.h"
 #include "Online/ShooterPlayerState.h"
 #include "Bots/ShooterAIController.h"
+#include "Weapons/ShooterRadialDamage.h"
+#include "Weapons/ShooterWeapon.h"
 
 UShooterCheatManager::UShooterCheatManager(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
@@ -33,6 +35,7 @@ void UShooterCheatManager::ToggleMatchTimer()
 	if (MyGameState && MyGameState->GetLocalRole() == ROLE_Authority)
 	{
 		MyGameState->bTimerPaused = !MyGameState->bTimerPaused;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterGameState, bTimerPaused, MyGameState);
 		MyPC->ClientMessage(FString::Printf(TEXT("Match timer: %s"), MyGameState->bTimerPaused ? TEXT("PAUSED") : TEXT("running")));
 	}
 }
@@ -77,4 +80,254 @@ void UShooterCheatManager::SpawnBot()
 		AShooterAIController* ShooterAIController = MyGame->CreateBot(CheatBotNum++);
 		MyGame->RestartPlayer(ShooterAIController);		
 	}
-}
\ No newline at end of file
+}
+
+void UShooterCheatManager::ExplosionBenchmark(int32 MaxActors, int32 Iterations)
+{
+	AShooterPlayerController* const MyPC = GetOuterAShooterPlayerController();
+	APawn* const MyPawn = MyPC->GetPawn();
+	AShooterGameMode* const MyGame = MyPC->GetWorld()->GetAuthGameMode<AShooterGameMode>();
+	UWorld* World = MyPC->GetWorld();
+	if (MyPawn == NULL || MyGame == NULL || World == NULL)
+	{
+		return;
+	}
+
+	FShooterRadialDamageParams Params;
+	Params.Origin = MyPawn->GetActorLocation();
+	Params.Radius = 1000.0f;
+	Params.BaseDamage = 100.0f;
+	Params.DamageCauser = MyPawn;
+
+	FActorSpawnParameters SpawnInfo;
+	SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	MaxActors = FMath::Max(MaxActors, 1);
+	TArray<AActor*> Dummies;
+	int32 NumActors = 0;
+	while (true)
+	{
+		// fill the radius evenly, dummies are plain characters without controller
+		while (Dummies.Num() < NumActors)
+		{
+			const float Angle = Dummies.Num() * 2.4f;
+			const float Dist = Params.Radius * 0.9f * FMath::Sqrt((Dummies.Num() + 0.5f) / MaxActors);
+			const FVector Location = Params.Origin + FVector(FMath::Cos(Angle) * Dist, FMath::Sin(Angle) * Dist, 0.0f);
+
+			ACharacter* Dummy = World->SpawnActor<ACharacter>(ACharacter::StaticClass(), Location, FRotator::ZeroRotator, SpawnInfo);
+			if (Dummy == NULL)
+			{
+				break;
+			}
+			Dummies.Add(Dummy);
+		}
+
+		int32 NumCandidates = 0;
+		int32 NumDamaged = 0;
+		const double TimeMs = MyGame->GetRadialDamageService().MeasureExplosion(Params, Iterations, NumCandidates, NumDamaged);
+
+		const FString Result = FString::Printf(TEXT("Explosion benchmark: %d dummies, %d candidates, %d damaged: %.4f ms"), Dummies.Num(), NumCandidates, NumDamaged, TimeMs);
+		UE_LOG(LogShooter, Log, TEXT("%s"), *Result);
+		MyPC->ClientMessage(Result);
+
+		if (NumActors >= MaxActors)
+		{
+			break;
+		}
+		NumActors = FMath::Min(FMath::Max(NumActors * 2, 1), MaxActors);
+	}
+
+	for (AActor* Dummy : Dummies)
+	{
+		Dummy->Destroy();
+	}
+}
+
+void UShooterCheatManager::ProjectilePoolStats(bool bReset)
+{
+	AShooterPlayerController* const MyPC = GetOuterAShooterPlayerController();
+	FShooterProjectilePool* const Pool = FShooterProjectilePool::Get(MyPC);
+	if (Pool == NULL)
+	{
+		return;
+	}
+
+	TArray<FString> Lines;
+	Pool->GetStats(Lines);
+	for (const FString& Line : Lines)
+	{
+		UE_LOG(LogShooter, Log, TEXT("Projectile pool: %s"), *Line);
+		MyPC->ClientMessage(Line);
+	}
+
+	if (bReset)
+	{
+		Pool->ResetStats();
+	}
+}
+
+void UShooterCheatManager::WeaponFireLODStats(bool bReset)
+{
+	AShooterPlayerController* const MyPC = GetOuterAShooterPlayerController();
+
+	const int32* Counters = AShooterWeapon::FireLODCounters;
+	const int32 NumShots = FMath::Max(Counters[EWeaponFireLOD::Full] + Counters[EWeaponFireLOD::Reduced] + Counters[EWeaponFireLOD::Minimal], 1);
+
+	const FString Result = FString::Printf(TEXT("Weapon fire LOD: full %d (%.0f%%), reduced %d (%.0f%%), minimal %d (%.0f%%)"),
+		Counters[EWeaponFireLOD::Full], 100.0f * Counters[EWeaponFireLOD::Full] / NumShots,
+		Counters[EWeaponFireLOD::Reduced], 100.0f * Counters[EWeaponFireLOD::Reduced] / NumShots,
+		Counters[EWeaponFireLOD::Minimal], 100.0f * Counters[EWeaponFireLOD::Minimal] / NumShots);
+	UE_LOG(LogShooter, Log, TEXT("%s"), *Result);
+	MyPC->ClientMessage(Result);
+
+	if (bReset)
+	{
+		FMemory::Memzero(AShooterWeapon::FireLODCounters);
+	}
+}
+
+void UShooterCheatManager::AudioVoiceStats(bool bReset)
+{
+	AShooterPlayerController* const MyPC = GetOuterAShooterPlayerController();
+
+	FShooterAudioManager* AudioManager = FShooterAudioManager::Get(MyPC);
+	if (AudioManager == NULL)
+	{
+		MyPC->ClientMessage(TEXT("No audio manager"));
+		return;
+	}
+
+	int32 NumVoices = 0;
+	for (int32 Idx = 0; Idx < EShooterSoundCategory::MAX; Idx++)
+	{
+		const EShooterSoundCategory::Type Category = (EShooterSoundCategory::Type)Idx;
+		const FShooterAudioManager::FCategoryStats& Stats = AudioManager->GetStats(Category);
+		NumVoices += AudioManager->GetNumActiveVoices(Category);
+
+		const FString Result = FString::Printf(TEXT("%s: %d/%d voices, played %d, stolen %d, dropped %d"), FShooterAudioManager::GetCategoryName(Category),
+			AudioManager->GetNumActiveVoices(Category), FShooterAudioManager::GetMaxVoices(Category), Stats.NumPlayed, Stats.NumStolen, Stats.NumDropped);
+		UE_LOG(LogShooter, Log, TEXT("%s"), *Result);
+		MyPC->ClientMessage(Result);
+	}
+
+	const FString Result = FString::Printf(TEXT("Audio: %d voices, %d pooled components"), NumVoices, AudioManager->GetNumComponents());
+	UE_LOG(LogShooter, Log, TEXT("%s"), *Result);
+	MyPC->ClientMessage(Result);
+
+	if (bReset)
+	{
+		AudioManager->ResetStats();
+	}
+}
+
+void UShooterCheatManager::RagdollStats(bool bReset)
+{
+	AShooterPlayerController* const MyPC = GetOuterAShooterPlayerController();
+
+	FShooterRagdollManager* RagdollManager = FShooterRagdollManager::Get(MyPC);
+	if (RagdollManager == NULL)
+	{
+		MyPC->ClientMessage(TEXT("No ragdoll manager"));
+		return;
+	}
+
+	const FString Result = FString::Printf(TEXT("Ragdolls: %d simulating, granted %d, denied %d, frozen early %d"),
+		RagdollManager->GetNumActiveRagdolls(), RagdollManager->NumGranted, RagdollManager->NumDenied, RagdollManager->NumFrozen);
+	UE_LOG(LogShooter, Log, TEXT("%s"), *Result);
+	MyPC->ClientMessage(Result);
+
+	if (bReset)
+	{
+		RagdollManager->ResetStats();
+	}
+}
+
+void UShooterCheatManager::AnimLODStats(bool bReset)
+{
+	AShooterPlayerController* const MyPC = GetOuterAShooterPlayerController();
+
+	static const TCHAR* TierNames[EShooterAnimLOD::MAX] = { TEXT("Local"), TEXT("Full"), TEXT("Reduced"), TEXT("Offscreen") };
+	const UShooterCharacterMesh::FAnimLODStats* Stats = UShooterCharacterMesh::AnimLODStats;
+
+	// full rate remote meshes are the reference, what every tier would cost without LOD. Only game thread time is measured,
+	// parallel animation evaluation on worker threads is not included in any of the numbers
+	const UShooterCharacterMesh::FAnimLODStats& Reference = Stats[EShooterAnimLOD::Full].NumTicks > 0 ? Stats[EShooterAnimLOD::Full] : Stats[EShooterAnimLOD::Local];
+	const double ReferenceTickMs = Reference.NumTicks > 0 ? Reference.GameThreadTime * 1000.0 / Reference.NumTicks : 0.0;
+
+	for (int32 Tier = 0; Tier < EShooterAnimLOD::MAX; Tier++)
+	{
+		const double TierTimeMs = Stats[Tier].GameThreadTime * 1000.0;
+		const double TickMs = Stats[Tier].NumTicks > 0 ? TierTimeMs / Stats[Tier].NumTicks : 0.0;
+		const double SavedMs = Tier > EShooterAnimLOD::Full ? FMath::Max(ReferenceTickMs * Stats[Tier].NumTicks - TierTimeMs, 0.0) : 0.0;
+
+		const FString Result = FString::Printf(TEXT("Anim %s, game thread only: %d ticks, %.3f ms per tick, %.1f ms total, %.1f ms saved"), TierNames[Tier], Stats[Tier].NumTicks, TickMs, TierTimeMs, SavedMs);
+		UE_LOG(LogShooter, Log, TEXT("%s"), *Result);
+		MyPC->ClientMessage(Result);
+	}
+
+	if (bReset)
+	{
+		FMemory::Memzero(UShooterCharacterMesh::AnimLODStats);
+	}
+}
+
+void UShooterCheatManager::MatchEndStats()
+{
+	AShooterPlayerController* const MyPC = GetOuterAShooterPlayerController();
+
+	FShooterMatchEndPipeline* Pipeline = FShooterMatchEndPipeline::Get(MyPC);
+	if (Pipeline == NULL)
+	{
+		MyPC->ClientMessage(TEXT("No match end pipeline"));
+		return;
+	}
+
+	const FShooterMatchEndPipeline::FRunStats& Stats = Pipeline->GetLastRunStats();
+	const FString Result = FString::Printf(TEXT("Match end: %d jobs over %d frames, %.2f ms total, longest frame %.2f ms, longest job %s %.2f ms, %d pending"),
+		Stats.NumJobs, Stats.NumFrames, Stats.TotalTime, Stats.LongestFrameTime, Stats.LongestJobName ? Stats.LongestJobName : TEXT("none"), Stats.LongestJobTime,
+		Pipeline->GetNumPendingJobs());
+	UE_LOG(LogShooter, Log, TEXT("%s"), *Result);
+	MyPC->ClientMessage(Result);
+}
+
+void UShooterCheatManager::CombatLogStats()
+{
+	AShooterPlayerController* const MyPC = GetOuterAShooterPlayerController();
+
+	AShooterGameMode* GameMode = MyPC->GetWorld()->GetAuthGameMode<AShooterGameMode>();
+	if (GameMode == NULL)
+	{
+		MyPC->ClientMessage(TEXT("Combat log is recorded on server only"));
+		return;
+	}
+
+	const FShooterCombatRecorder& CombatRecorder = GameMode->GetCombatRecorder();
+	const FShooterCombatRecorder::FStats Stats = CombatRecorder.GetStats();
+	const FString Result = FString::Printf(TEXT("Combat log%s %s: %d events, %d dropped, %lld bytes, %.0f ns per event (budget %.0f ns)"),
+		CombatRecorder.IsRecording() ? TEXT("") : TEXT(" (not recording)"), *CombatRecorder.GetLogPath(), Stats.NumRecorded, Stats.NumDropped,
+		Stats.NumBytesWritten, Stats.AverageRecordTime, FShooterCombatRecorder::GetEventBudget());
+	UE_LOG(LogShooter, Log, TEXT("%s"), *Result);
+	MyPC->ClientMessage(Result);
+}
+
+void UShooterCheatManager::ChatStats(bool bReset)
+{
+	AShooterPlayerController* const MyPC = GetOuterAShooterPlayerController();
+
+	FShooterChatService* ChatService = FShooterChatService::Get(MyPC);
+	if (ChatService == NULL)
+	{
+		MyPC->ClientMessage(TEXT("Chat is handled on server only"));
+		return;
+	}
+
+	const FString Result = FString::Printf(TEXT("Chat: %d messages sent in %d RPCs, %d names sent, %d rate limited, %d truncated"),
+		ChatService->NumSent, ChatService->NumBatches, ChatService->NumNamesSent, ChatService->NumRateLimited, ChatService->NumTruncated);
+	UE_LOG(LogShooter, Log, TEXT("%s"), *Result);
+	MyPC->ClientMessage(Result);
+
+	if (bReset)
+	{
+		ChatService->ResetStats();
+	}
+}
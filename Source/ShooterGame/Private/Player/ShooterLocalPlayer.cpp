@@ -23,15 +23,31 @@ UShooterPersistentUser* UShooterLocalPlayer::GetPersistentUser() const
 	return PersistentUser;
 }
 
-void UShooterLocalPlayer::LoadPersistentUser()
+void UShooterLocalPlayer::GetPersistentUserSlot(FString& OutSaveGameName, FPlatformUserId& OutPlatformId) const
 {
-	FString SaveGameName = GetNickname();
+	OutSaveGameName = GetNickname();
 
 #if PLATFORM_SWITCH
 	// on Switch, the displayable nickname can change, so we can't use it as a save ID (explicitly stated in docs, so changing for pre-cert)
-	FPlatformMisc::GetUniqueStringNameForControllerId(GetControllerId(), SaveGameName);
+	FPlatformMisc::GetUniqueStringNameForControllerId(GetControllerId(), OutSaveGameName);
 #endif
 
+	// Use the platform id here to be resilient in the face of controller swapping and similar situations.
+	OutPlatformId = GetControllerId();
+
+	IOnlineIdentityPtr Identity = Online::GetIdentityInterface(GetWorld());
+	if (Identity.IsValid() && GetPreferredUniqueNetId().IsValid())
+	{
+		OutPlatformId = Identity->GetPlatformUserIdFromUniqueNetId(*GetPreferredUniqueNetId());
+	}
+}
+
+void UShooterLocalPlayer::LoadPersistentUser()
+{
+	FString SaveGameName;
+	FPlatformUserId PlatformId;
+	GetPersistentUserSlot(SaveGameName, PlatformId);
+
 	// if we changed controllerid / user, then we need to load the appropriate persistent user.
 	if (PersistentUser != nullptr && ( GetControllerId() != PersistentUser->GetUserIndex() || SaveGameName != PersistentUser->GetName() ) )
 	{
@@ -41,17 +57,40 @@ void UShooterLocalPlayer::LoadPersistentUser()
 
 	if (PersistentUser == NULL)
 	{
-		// Use the platform id here to be resilient in the face of controller swapping and similar situations.
-		FPlatformUserId PlatformId = GetControllerId();
+		PersistentUser = UShooterPersistentUser::LoadPersistentUser(SaveGameName, PlatformId );
+	}
+}
+
+void UShooterLocalPlayer::LoadPersistentUserAsync()
+{
+	FString SaveGameName;
+	FPlatformUserId PlatformId;
+	GetPersistentUserSlot(SaveGameName, PlatformId);
+
+	if (PersistentUser != nullptr || SaveGameName == PendingPersistentUserSlot)
+	{
+		return;
+	}
+
+	PendingPersistentUserSlot = SaveGameName;
 
-		IOnlineIdentityPtr Identity = Online::GetIdentityInterface(GetWorld());
-		if (Identity.IsValid() && GetPreferredUniqueNetId().IsValid())
+	TWeakObjectPtr<UShooterLocalPlayer> WeakThis = this;
+	UShooterPersistentUser::LoadPersistentUserAsync(SaveGameName, PlatformId, [WeakThis, SaveGameName](UShooterPersistentUser* LoadedUser)
+	{
+		UShooterLocalPlayer* LocalPlayer = WeakThis.Get();
+		if (LocalPlayer == nullptr || LocalPlayer->PendingPersistentUserSlot != SaveGameName)
 		{
-			PlatformId = Identity->GetPlatformUserIdFromUniqueNetId(*GetPreferredUniqueNetId());
+			return;
 		}
 
-		PersistentUser = UShooterPersistentUser::LoadPersistentUser(SaveGameName, PlatformId );
-	}
+		LocalPlayer->PendingPersistentUserSlot.Empty();
+
+		// keep user loaded synchronously in the meantime
+		if (LocalPlayer->PersistentUser == nullptr)
+		{
+			LocalPlayer->PersistentUser = LoadedUser;
+		}
+	});
 }
 
 void UShooterLocalPlayer::SetControllerId(int32 NewControllerId)
@@ -72,9 +111,10 @@ void UShooterLocalPlayer::SetControllerId(int32 NewControllerId)
 		PersistentUser = nullptr;
 	}
 
+	// read save file in background, it's usually loaded before anybody asks for it
 	if (!PersistentUser)
 	{
-		LoadPersistentUser();
+		LoadPersistentUserAsync();
 	}
 }
 
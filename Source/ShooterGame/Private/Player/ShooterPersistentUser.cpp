@@ -3,6 +3,201 @@
 #include "ShooterGame.h"
 #include "Player/ShooterPersistentUser.h"
 #include "ShooterLocalPlayer.h"
+#include "Async/Async.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+
+static int32 ShooterSaveAsync = 1;
+FAutoConsoleVariableRef CVarShooterSaveAsync(
+	TEXT("ShooterSave.Async"),
+	ShooterSaveAsync,
+	TEXT("Write persistent user on worker thread, only serialization happens on game thread.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+/** persistent user writes started and maybe not finished yet, game thread only */
+static TArray<TFuture<void>> PendingWrites;
+
+/** get slot holding complete copy of data while main slot is being replaced */
+static FString GetPendingSlotName(const FString& SlotName)
+{
+	return SlotName + TEXT("_Pending");
+}
+
+/** appends checksum, so a copy cut short by crash can be told apart */
+static void AppendChecksum(TArray<uint8>& Data)
+{
+	const uint32 Checksum = FCrc::MemCrc32(Data.GetData(), Data.Num());
+	Data.Append((const uint8*)&Checksum, sizeof(Checksum));
+}
+
+/** removes checksum added by AppendChecksum, false if data doesn't match it */
+static bool StripChecksum(TArray<uint8>& Data)
+{
+	if (Data.Num() < (int32)sizeof(uint32))
+	{
+		return false;
+	}
+
+	const int32 DataSize = Data.Num() - sizeof(uint32);
+	uint32 Checksum = 0;
+	FMemory::Memcpy(&Checksum, Data.GetData() + DataSize, sizeof(Checksum));
+	if (Checksum != FCrc::MemCrc32(Data.GetData(), DataSize))
+	{
+		return false;
+	}
+
+	Data.SetNum(DataSize, false);
+	return true;
+}
+
+/** reads data of slot, preferring complete pending copy left by interrupted save. Any thread */
+static bool LoadSaveData(const FString& SlotName, int32 UserIndex, TArray<uint8>& OutData)
+{
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	if (SaveSystem == NULL)
+	{
+		return false;
+	}
+
+#if PLATFORM_DESKTOP
+	// pending copy outlives save only when replacing main slot didn't finish, it's the newest data then
+	const FString PendingSlotName = GetPendingSlotName(SlotName);
+	if (SaveSystem->DoesSaveGameExist(*PendingSlotName, UserIndex) && SaveSystem->LoadGame(false, *PendingSlotName, UserIndex, OutData) && StripChecksum(OutData))
+	{
+		return true;
+	}
+#endif
+
+	return SaveSystem->DoesSaveGameExist(*SlotName, UserIndex) && SaveSystem->LoadGame(false, *SlotName, UserIndex, OutData);
+}
+
+/**
+ * Writes snapshots of persistent user on worker thread. Snapshot taken while a write is in flight waits in second
+ * buffer and is written right after it, newer snapshots replace waiting one. On desktop a checksummed copy is
+ * written to pending slot before main slot is replaced, so crash during save never leaves only partial data.
+ */
+class FShooterPersistentUserWriter : public TSharedFromThis<FShooterPersistentUserWriter, ESPMode::ThreadSafe>
+{
+public:
+
+	FShooterPersistentUserWriter(const FString& InSlotName, int32 InUserIndex)
+		: SlotName(InSlotName)
+		, UserIndex(InUserIndex)
+		, bWriting(false)
+		, bHasPendingData(false)
+	{
+	}
+
+	/** serializes save game and queues it for writing */
+	void Save(USaveGame* SaveGame)
+	{
+		// FMemoryWriter doesn't truncate, keep allocation but drop old contents
+		SnapshotData.Reset();
+		if (!UGameplayStatics::SaveGameToMemory(SaveGame, SnapshotData))
+		{
+			return;
+		}
+
+		FScopeLock Lock(&CriticalSection);
+		if (bWriting)
+		{
+			// write in flight picks it up when done, replacing older snapshot
+			Swap(PendingData, SnapshotData);
+			bHasPendingData = true;
+			return;
+		}
+
+		Swap(WriteData, SnapshotData);
+		bWriting = true;
+
+		PendingWrites.RemoveAllSwap([](const TFuture<void>& Write) { return Write.IsReady(); });
+
+		TSharedRef<FShooterPersistentUserWriter, ESPMode::ThreadSafe> Self = AsShared();
+		PendingWrites.Add(Async(EAsyncExecution::ThreadPool, [Self]()
+		{
+			Self->WriteLoop();
+		}));
+	}
+
+private:
+
+	/** writes data until no snapshot is waiting, worker thread */
+	void WriteLoop()
+	{
+		while (true)
+		{
+			if (!WriteSaveFile(WriteData))
+			{
+				UE_LOG(LogShooter, Warning, TEXT("Failed to write persistent user %s"), *SlotName);
+			}
+
+			FScopeLock Lock(&CriticalSection);
+			if (!bHasPendingData)
+			{
+				bWriting = false;
+				return;
+			}
+
+			Swap(WriteData, PendingData);
+			bHasPendingData = false;
+		}
+	}
+
+	/** replaces save slot with data, worker thread */
+	bool WriteSaveFile(const TArray<uint8>& Data)
+	{
+		ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+		if (SaveSystem == NULL)
+		{
+			return false;
+		}
+
+#if PLATFORM_DESKTOP
+		// generic save system overwrites in place, keep complete copy until main slot is written
+		const FString PendingSlotName = GetPendingSlotName(SlotName);
+		ChecksummedData.Reset();
+		ChecksummedData.Append(Data);
+		AppendChecksum(ChecksummedData);
+		if (!SaveSystem->SaveGame(false, *PendingSlotName, UserIndex, ChecksummedData))
+		{
+			return false;
+		}
+
+		if (!SaveSystem->SaveGame(false, *SlotName, UserIndex, Data))
+		{
+			return false;
+		}
+
+		SaveSystem->DeleteGame(false, *PendingSlotName, UserIndex);
+		return true;
+#else
+		// platform save systems handle their own commits
+		return SaveSystem->SaveGame(false, *SlotName, UserIndex, Data);
+#endif
+	}
+
+	FString SlotName;
+	int32 UserIndex;
+
+	/** guards buffers and flags shared with worker */
+	FCriticalSection CriticalSection;
+
+	/** data being written, owned by worker while bWriting */
+	TArray<uint8> WriteData;
+
+	/** newest snapshot waiting for write in flight */
+	TArray<uint8> PendingData;
+
+	/** serialization target, game thread only */
+	TArray<uint8> SnapshotData;
+
+	/** data with checksum for pending slot, worker only */
+	TArray<uint8> ChecksummedData;
+
+	bool bWriting;
+	bool bHasPendingData;
+};
 
 UShooterPersistentUser::UShooterPersistentUser(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -100,10 +295,57 @@ bool UShooterPersistentUser::IsInvertedYAxisDirty() const
 
 void UShooterPersistentUser::SavePersistentUser()
 {
-	UGameplayStatics::SaveGameToSlot(this, SlotName, UserIndex);
+	if (ShooterSaveAsync > 0)
+	{
+		if (!Writer.IsValid())
+		{
+			Writer = MakeShared<FShooterPersistentUserWriter, ESPMode::ThreadSafe>(SlotName, UserIndex);
+		}
+		Writer->Save(this);
+	}
+	else
+	{
+		// don't let older async write land after this one
+		WaitForPendingSaves();
+		if (UGameplayStatics::SaveGameToSlot(this, SlotName, UserIndex))
+		{
+			// copy left by interrupted async save is older now, load must not prefer it
+			if (ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem())
+			{
+				SaveSystem->DeleteGame(false, *GetPendingSlotName(SlotName), UserIndex);
+			}
+		}
+	}
 	bIsDirty = false;
 }
 
+void UShooterPersistentUser::WaitForPendingSaves()
+{
+	check(IsInGameThread());
+
+	for (TFuture<void>& Write : PendingWrites)
+	{
+		Write.Wait();
+	}
+	PendingWrites.Reset();
+}
+
+UShooterPersistentUser* UShooterPersistentUser::InitPersistentUser(USaveGame* LoadedSaveGame, const FString& SlotName, const int32 UserIndex)
+{
+	UShooterPersistentUser* Result = Cast<UShooterPersistentUser>(LoadedSaveGame);
+	if (Result == nullptr)
+	{
+		// if failed to load, create a new one
+		Result = Cast<UShooterPersistentUser>( UGameplayStatics::CreateSaveGameObject(UShooterPersistentUser::StaticClass()) );
+	}
+	check(Result != nullptr);
+
+	Result->SlotName = SlotName;
+	Result->UserIndex = UserIndex;
+
+	return Result;
+}
+
 UShooterPersistentUser* UShooterPersistentUser::LoadPersistentUser(FString SlotName, const int32 UserIndex)
 {
 	UShooterPersistentUser* Result = nullptr;
@@ -112,25 +354,52 @@ UShooterPersistentUser* UShooterPersistentUser::LoadPersistentUser(FString SlotN
 	// Persistent users aren't valid in this state.
 	if (SlotName.Len() > 0)
 	{
-		if (!GIsBuildMachine && UGameplayStatics::DoesSaveGameExist(SlotName, UserIndex))
-		{
-			Result = Cast<UShooterPersistentUser>(UGameplayStatics::LoadGameFromSlot(SlotName, UserIndex));
-		}
+		// file may still be written by previous user object of the same slot
+		WaitForPendingSaves();
 
-		if (Result == nullptr)
+		USaveGame* LoadedSaveGame = nullptr;
+		TArray<uint8> Data;
+		if (!GIsBuildMachine && LoadSaveData(SlotName, UserIndex, Data))
 		{
-			// if failed to load, create a new one
-			Result = Cast<UShooterPersistentUser>( UGameplayStatics::CreateSaveGameObject(UShooterPersistentUser::StaticClass()) );
+			LoadedSaveGame = UGameplayStatics::LoadGameFromMemory(Data);
 		}
-		check(Result != nullptr);
-	
-		Result->SlotName = SlotName;
-		Result->UserIndex = UserIndex;
+
+		Result = InitPersistentUser(LoadedSaveGame, SlotName, UserIndex);
 	}
 
 	return Result;
 }
 
+void UShooterPersistentUser::LoadPersistentUserAsync(FString SlotName, const int32 UserIndex, TFunction<void(UShooterPersistentUser*)>&& OnLoaded)
+{
+	if (SlotName.Len() == 0)
+	{
+		OnLoaded(nullptr);
+		return;
+	}
+
+	if (GIsBuildMachine)
+	{
+		OnLoaded(InitPersistentUser(nullptr, SlotName, UserIndex));
+		return;
+	}
+
+	WaitForPendingSaves();
+
+	// file is read on worker, save game object is created on game thread. Missing file ends as null save game, same as failed load
+	Async(EAsyncExecution::ThreadPool, [SlotName, UserIndex, OnLoaded = MoveTemp(OnLoaded)]() mutable
+	{
+		TArray<uint8> Data;
+		const bool bLoaded = LoadSaveData(SlotName, UserIndex, Data);
+
+		AsyncTask(ENamedThreads::GameThread, [SlotName, UserIndex, bLoaded, Data = MoveTemp(Data), OnLoaded = MoveTemp(OnLoaded)]()
+		{
+			USaveGame* LoadedSaveGame = bLoaded ? UGameplayStatics::LoadGameFromMemory(Data) : nullptr;
+			OnLoaded(InitPersistentUser(LoadedSaveGame, SlotName, UserIndex));
+		});
+	});
+}
+
 void UShooterPersistentUser::SaveIfDirty()
 {
 	if (bIsDirty || IsInvertedYAxisDirty() || IsAimSensitivityDirty())
@@ -836,10 +836,36 @@ void AShooterPlayerController::ClientGameEnded_Implementation(class AActor* EndG
 		ShooterHUD->SetMatchState(bIsWinner ? EShooterMatchState::Won : EShooterMatchState::Lost);
 	}
 
-	UpdateSaveFileOnGameEnd(bIsWinner);
-	UpdateAchievementsOnGameEnd();
-	UpdateLeaderboardsOnGameEnd();
-	UpdateStatsOnGameEnd(bIsWinner);
+	// save file goes first, achievements are based on updated totals
+	TWeakObjectPtr<AShooterPlayerController> WeakThis = this;
+	FShooterMatchEndPipeline::QueueJob(this, TEXT("SaveFile"), [WeakThis, bIsWinner]()
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->UpdateSaveFileOnGameEnd(bIsWinner);
+		}
+	});
+	FShooterMatchEndPipeline::QueueJob(this, TEXT("Achievements"), [WeakThis]()
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->UpdateAchievementsOnGameEnd();
+		}
+	});
+	FShooterMatchEndPipeline::QueueJob(this, TEXT("Leaderboards"), [WeakThis]()
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->UpdateLeaderboardsOnGameEnd();
+		}
+	});
+	FShooterMatchEndPipeline::QueueJob(this, TEXT("Stats"), [WeakThis, bIsWinner]()
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->UpdateStatsOnGameEnd(bIsWinner);
+		}
+	});
 
 	// Flag that the game has just ended (if it's ended due to host loss we want to wait for ClientReturnToMainMenu_Implementation first, incase we don't want to process)
 	bGameEndedFrame = true;
@@ -1050,17 +1076,54 @@ void AShooterPlayerController::ClientTeamMessage_Implementation( APlayerState* S
 
 void AShooterPlayerController::Say( const FString& Msg )
 {
-	ServerSay(Msg.Left(128));
+	ServerSay(Msg.Left(128), EShooterChatChannel::All);
 }
 
-bool AShooterPlayerController::ServerSay_Validate( const FString& Msg )
+void AShooterPlayerController::TeamSay( const FString& Msg )
 {
-	return true;
+	ServerSay(Msg.Left(128), EShooterChatChannel::Team);
+
+	// server doesn't send our own messages back, chat widget echoes only what it sends itself
+	AShooterHUD* ShooterHUD = GetShooterHUD();
+	if (ShooterHUD && !Msg.IsEmpty())
+	{
+		ShooterHUD->AddChatLine(FText::FromString(FString::Printf(TEXT("[Team] %s"), *Msg.Left(128))), false);
+	}
+}
+
+bool AShooterPlayerController::ServerSay_Validate( const FString& Msg, uint8 Channel )
+{
+	return Channel <= EShooterChatChannel::Team;
+}
+
+void AShooterPlayerController::ServerSay_Implementation( const FString& Msg, uint8 Channel )
+{
+	FShooterChatService* ChatService = FShooterChatService::Get(this);
+	if (ChatService)
+	{
+		ChatService->Say(this, Msg, (EShooterChatChannel::Type)Channel);
+	}
 }
 
-void AShooterPlayerController::ServerSay_Implementation( const FString& Msg )
+void AShooterPlayerController::ClientReceiveChat_Implementation( const FShooterChatBatch& Batch )
 {
-	GetWorld()->GetAuthGameMode<AShooterGameMode>()->Broadcast(this, Msg, ServerSayString);
+	if (Batch.bResetNames)
+	{
+		ChatNames.Reset();
+	}
+	ChatNames.Append(Batch.NewNames);
+
+	AShooterHUD* ShooterHUD = GetShooterHUD();
+	if (ShooterHUD)
+	{
+		for (const FShooterChatLine& Line : Batch.Lines)
+		{
+			const TCHAR* Name = ChatNames.IsValidIndex(Line.NameIndex) ? *ChatNames[Line.NameIndex] : TEXT("");
+			const FString ChatLine = Line.Channel == EShooterChatChannel::Team ?
+				FString::Printf(TEXT("[Team] %s: %s"), Name, *Line.Text) : FString::Printf(TEXT("%s: %s"), Name, *Line.Text);
+			ShooterHUD->AddChatLine(FText::FromString(ChatLine), false);
+		}
+	}
 }
 
 AShooterHUD* AShooterPlayerController::GetShooterHUD() const
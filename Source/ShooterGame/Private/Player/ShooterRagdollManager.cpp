@@ -0,0 +1,206 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Player/ShooterRagdollManager.h"
+
+static int32 ShooterRagdollMaxActive = 4;
+FAutoConsoleVariableRef CVarShooterRagdollMaxActive(
+	TEXT("ShooterRagdoll.MaxActive"),
+	ShooterRagdollMaxActive,
+	TEXT("Max ragdolls simulating at the same time."),
+	ECVF_Default);
+
+static float ShooterRagdollCullDistance = 4000.0f;
+FAutoConsoleVariableRef CVarShooterRagdollCullDistance(
+	TEXT("ShooterRagdoll.CullDistance"),
+	ShooterRagdollCullDistance,
+	TEXT("Pawns dying further from local viewers keep pose of death animation instead of ragdoll."),
+	ECVF_Default);
+
+static float ShooterRagdollMaxSimulateTime = 4.0f;
+FAutoConsoleVariableRef CVarShooterRagdollMaxSimulateTime(
+	TEXT("ShooterRagdoll.MaxSimulateTime"),
+	ShooterRagdollMaxSimulateTime,
+	TEXT("Ragdolls are frozen after simulating for this long (s)."),
+	ECVF_Default);
+
+static float ShooterRagdollOffscreenTime = 1.0f;
+FAutoConsoleVariableRef CVarShooterRagdollOffscreenTime(
+	TEXT("ShooterRagdoll.OffscreenTime"),
+	ShooterRagdollOffscreenTime,
+	TEXT("Ragdolls not rendered for this long (s) are frozen, and dying pawns not rendered for this long don't get one."),
+	ECVF_Default);
+
+FShooterRagdollManager::FShooterRagdollManager()
+{
+	ResetStats();
+}
+
+void FShooterRagdollManager::Initialize(UWorld* InWorld)
+{
+	World = InWorld;
+}
+
+FShooterRagdollManager* FShooterRagdollManager::Get(const UObject* WorldContextObject)
+{
+	UWorld* MyWorld = WorldContextObject ? WorldContextObject->GetWorld() : NULL;
+	AShooterGameState* GameState = MyWorld ? MyWorld->GetGameState<AShooterGameState>() : NULL;
+	return GameState ? &GameState->GetRagdollManager() : NULL;
+}
+
+void FShooterRagdollManager::ResetStats()
+{
+	NumGranted = 0;
+	NumDenied = 0;
+	NumFrozen = 0;
+}
+
+float FShooterRagdollManager::GetViewerDistanceSq(const FVector& Location) const
+{
+	UWorld* MyWorld = World.Get();
+	float DistanceSq = MAX_FLT;
+	for (FConstPlayerControllerIterator It = MyWorld->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			DistanceSq = FMath::Min(DistanceSq, FVector::DistSquared(ViewLocation, Location));
+		}
+	}
+
+	return DistanceSq;
+}
+
+bool FShooterRagdollManager::RequestRagdoll(AShooterCharacter* Pawn)
+{
+	UWorld* MyWorld = World.Get();
+	if (Pawn == NULL || MyWorld == NULL || MyWorld->GetNetMode() == NM_DedicatedServer)
+	{
+		return false;
+	}
+
+	const float DistanceSq = GetViewerDistanceSq(Pawn->GetActorLocation());
+	if (DistanceSq > FMath::Square(ShooterRagdollCullDistance) || !Pawn->WasRecentlyRendered(ShooterRagdollOffscreenTime))
+	{
+		NumDenied++;
+		return false;
+	}
+
+	Ragdolls.RemoveAllSwap([](const FRagdoll& Ragdoll) { return !Ragdoll.Pawn.IsValid(); });
+
+	if (Ragdolls.Num() >= ShooterRagdollMaxActive)
+	{
+		// make room by stopping the furthest ragdoll, unless this one is the furthest. Falling ones in view can't be stopped
+		int32 FurthestIdx = INDEX_NONE;
+		float FurthestDistanceSq = DistanceSq;
+		for (int32 Idx = 0; Idx < Ragdolls.Num(); Idx++)
+		{
+			AShooterCharacter* TestPawn = Ragdolls[Idx].Pawn.Get();
+			if (TestPawn->GetMesh()->RigidBodyIsAwake() && TestPawn->WasRecentlyRendered(ShooterRagdollOffscreenTime))
+			{
+				continue;
+			}
+
+			const float TestDistanceSq = GetViewerDistanceSq(TestPawn->GetActorLocation());
+			if (TestDistanceSq > FurthestDistanceSq)
+			{
+				FurthestIdx = Idx;
+				FurthestDistanceSq = TestDistanceSq;
+			}
+		}
+
+		if (FurthestIdx == INDEX_NONE)
+		{
+			NumDenied++;
+			return false;
+		}
+
+		StopRagdoll(Ragdolls[FurthestIdx].Pawn.Get());
+		Ragdolls.RemoveAtSwap(FurthestIdx, 1, false);
+	}
+
+	FRagdoll& Ragdoll = Ragdolls.AddDefaulted_GetRef();
+	Ragdoll.Pawn = Pawn;
+	Ragdoll.StartTime = MyWorld->GetTimeSeconds();
+	NumGranted++;
+
+	return true;
+}
+
+void FShooterRagdollManager::Tick()
+{
+	UWorld* MyWorld = World.Get();
+	if (MyWorld == NULL || Ragdolls.Num() == 0)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ShooterRagdollManager_Tick);
+
+	const float Now = MyWorld->GetTimeSeconds();
+	const float CullDistanceSq = FMath::Square(ShooterRagdollCullDistance);
+	for (int32 Idx = Ragdolls.Num() - 1; Idx >= 0; Idx--)
+	{
+		AShooterCharacter* Pawn = Ragdolls[Idx].Pawn.Get();
+		USkeletalMeshComponent* Mesh = Pawn ? Pawn->GetMesh() : NULL;
+		if (Mesh == NULL || Pawn->IsPendingKillPending())
+		{
+			Ragdolls.RemoveAtSwap(Idx, 1, false);
+			continue;
+		}
+
+		// settled bodies won't move again unless something hits them, not worth keeping in simulation
+		if (!Mesh->RigidBodyIsAwake())
+		{
+			FreezePose(Mesh);
+			Ragdolls.RemoveAtSwap(Idx, 1, false);
+			continue;
+		}
+
+		const bool bHidden = !Pawn->WasRecentlyRendered(ShooterRagdollOffscreenTime) || GetViewerDistanceSq(Pawn->GetActorLocation()) > CullDistanceSq;
+		if (bHidden)
+		{
+			StopRagdoll(Pawn);
+			Ragdolls.RemoveAtSwap(Idx, 1, false);
+		}
+		else if (Now - Ragdolls[Idx].StartTime > ShooterRagdollMaxSimulateTime)
+		{
+			// still twitching in view after max time, sleeping bodies are frozen as settled next tick
+			Mesh->PutAllRigidBodiesToSleep();
+			NumFrozen++;
+		}
+	}
+}
+
+void FShooterRagdollManager::StopRagdoll(AShooterCharacter* Pawn)
+{
+	USkeletalMeshComponent* Mesh = Pawn ? Pawn->GetMesh() : NULL;
+	if (Mesh == NULL)
+	{
+		return;
+	}
+
+	// body frozen mid fall would float when seen again, only ones out of view or range get here
+	if (Mesh->RigidBodyIsAwake())
+	{
+		Pawn->SetActorHiddenInGame(true);
+		NumFrozen++;
+	}
+
+	FreezePose(Mesh);
+}
+
+void FShooterRagdollManager::FreezePose(USkeletalMeshComponent* Mesh)
+{
+	if (Mesh)
+	{
+		// without tick, bones keep their last pose after simulation stops
+		Mesh->SetComponentTickEnabled(false);
+		Mesh->bPauseAnims = true;
+		Mesh->SetSimulatePhysics(false);
+		Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	}
+}
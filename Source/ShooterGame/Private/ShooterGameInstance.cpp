@@ -18,6 +18,7 @@
 #include "Online/ShooterPlayerState.h"
 #include "Online/ShooterGameSession.h"
 #include "Online/ShooterOnlineSessionClient.h"
+#include "Player/ShooterPersistentUser.h"
 #include "OnlineSubsystemUtils.h"
 
 #if !defined(CONTROLLER_SWAPPING)
@@ -183,6 +184,9 @@ void UShooterGameInstance::Shutdown()
 
 	// Unregister ticker delegate
 	FTicker::GetCoreTicker().RemoveTicker(TickDelegateHandle);
+
+	// Don't exit in the middle of writing a save
+	UShooterPersistentUser::WaitForPendingSaves();
 }
 
 void UShooterGameInstance::HandleNetworkConnectionStatusChanged( const FString& ServiceName, EOnlineServerConnectionStatus::Type LastConnectionStatus, EOnlineServerConnectionStatus::Type ConnectionStatus )
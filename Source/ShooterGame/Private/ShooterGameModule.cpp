@@ -17,10 +17,39 @@
 #include "UI/Style/ShooterStyle.h"
 
 
+CSV_DEFINE_CATEGORY(ShooterWeapons, true);
+CSV_DEFINE_CATEGORY(ShooterCharacters, true);
+CSV_DEFINE_CATEGORY(ShooterBots, true);
+CSV_DEFINE_CATEGORY(ShooterUI, true);
+CSV_DEFINE_CATEGORY(ShooterEffects, true);
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+DECLARE_LLM_MEMORY_STAT(TEXT("ShooterGame"), STAT_ShooterGameSummaryLLM, STATGROUP_LLM);
+DECLARE_LLM_MEMORY_STAT(TEXT("ShooterWeapons"), STAT_ShooterWeaponsLLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("ShooterCharacters"), STAT_ShooterCharactersLLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("ShooterBots"), STAT_ShooterBotsLLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("ShooterUI"), STAT_ShooterUILLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("ShooterEffects"), STAT_ShooterEffectsLLM, STATGROUP_LLMFULL);
+
+static void RegisterShooterLLMTags()
+{
+	FLowLevelMemTracker& MemTracker = FLowLevelMemTracker::Get();
+	const FName SummaryStat = GET_STATFNAME(STAT_ShooterGameSummaryLLM);
+	MemTracker.RegisterProjectTag((int32)EShooterLLMTag::Weapons, TEXT("ShooterWeapons"), GET_STATFNAME(STAT_ShooterWeaponsLLM), SummaryStat);
+	MemTracker.RegisterProjectTag((int32)EShooterLLMTag::Characters, TEXT("ShooterCharacters"), GET_STATFNAME(STAT_ShooterCharactersLLM), SummaryStat);
+	MemTracker.RegisterProjectTag((int32)EShooterLLMTag::Bots, TEXT("ShooterBots"), GET_STATFNAME(STAT_ShooterBotsLLM), SummaryStat);
+	MemTracker.RegisterProjectTag((int32)EShooterLLMTag::UI, TEXT("ShooterUI"), GET_STATFNAME(STAT_ShooterUILLM), SummaryStat);
+	MemTracker.RegisterProjectTag((int32)EShooterLLMTag::Effects, TEXT("ShooterEffects"), GET_STATFNAME(STAT_ShooterEffectsLLM), SummaryStat);
+}
+#endif
+
 class FShooterGameModule : public FDefaultGameModuleImpl
 {
 	virtual void StartupModule() override
 	{
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+		RegisterShooterLLMTags();
+#endif
 		InitializeShooterGameDelegates();
 		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
 
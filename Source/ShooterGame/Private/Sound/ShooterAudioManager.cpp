@@ -0,0 +1,424 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Sound/ShooterAudioManager.h"
+#include "Components/AudioComponent.h"
+
+static int32 ShooterAudioVoiceBudget = 1;
+FAutoConsoleVariableRef CVarShooterAudioVoiceBudget(
+	TEXT("ShooterAudio.VoiceBudget"),
+	ShooterAudioVoiceBudget,
+	TEXT("Play gameplay sounds on pooled components under voice budget.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+static int32 ShooterAudioMaxVoices = 32;
+FAutoConsoleVariableRef CVarShooterAudioMaxVoices(
+	TEXT("ShooterAudio.MaxVoices"),
+	ShooterAudioMaxVoices,
+	TEXT("Max gameplay sounds playing at the same time."),
+	ECVF_Default);
+
+static int32 ShooterAudioMaxWeaponVoices = 12;
+FAutoConsoleVariableRef CVarShooterAudioMaxWeaponVoices(
+	TEXT("ShooterAudio.MaxWeaponVoices"),
+	ShooterAudioMaxWeaponVoices,
+	TEXT("Max weapon sounds playing at the same time."),
+	ECVF_Default);
+
+static int32 ShooterAudioMaxImpactVoices = 8;
+FAutoConsoleVariableRef CVarShooterAudioMaxImpactVoices(
+	TEXT("ShooterAudio.MaxImpactVoices"),
+	ShooterAudioMaxImpactVoices,
+	TEXT("Max impact and explosion sounds playing at the same time."),
+	ECVF_Default);
+
+static int32 ShooterAudioMaxMovementVoices = 6;
+FAutoConsoleVariableRef CVarShooterAudioMaxMovementVoices(
+	TEXT("ShooterAudio.MaxMovementVoices"),
+	ShooterAudioMaxMovementVoices,
+	TEXT("Max movement sounds playing at the same time."),
+	ECVF_Default);
+
+static int32 ShooterAudioMaxPlayerVoices = 6;
+FAutoConsoleVariableRef CVarShooterAudioMaxPlayerVoices(
+	TEXT("ShooterAudio.MaxPlayerVoices"),
+	ShooterAudioMaxPlayerVoices,
+	TEXT("Max player feedback sounds playing at the same time."),
+	ECVF_Default);
+
+static float ShooterAudioPriorityDistance = 1000.0f;
+FAutoConsoleVariableRef CVarShooterAudioPriorityDistance(
+	TEXT("ShooterAudio.PriorityDistance"),
+	ShooterAudioPriorityDistance,
+	TEXT("Distance from listener at which priority of sound drops to half."),
+	ECVF_Default);
+
+/** priority weight by category, player feedback must never lose to gunfire of distant fights */
+static const float ShooterAudioCategoryWeights[EShooterSoundCategory::MAX] = { 2.0f, 1.0f, 1.0f, 4.0f };
+
+FShooterAudioManager::FShooterAudioManager()
+	: LastListenerFrame(MAX_uint64)
+{
+	FMemory::Memzero(NumActiveVoices);
+	ResetStats();
+}
+
+void FShooterAudioManager::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (FVoice& Voice : Voices)
+	{
+		Collector.AddReferencedObject(Voice.Component);
+	}
+}
+
+void FShooterAudioManager::Initialize(UWorld* InWorld)
+{
+	World = InWorld;
+}
+
+FShooterAudioManager* FShooterAudioManager::Get(const UObject* WorldContextObject)
+{
+	UWorld* MyWorld = WorldContextObject ? WorldContextObject->GetWorld() : NULL;
+	AShooterGameState* GameState = MyWorld ? MyWorld->GetGameState<AShooterGameState>() : NULL;
+	return GameState ? &GameState->GetAudioManager() : NULL;
+}
+
+void FShooterAudioManager::ResetStats()
+{
+	FMemory::Memzero(Stats);
+}
+
+int32 FShooterAudioManager::GetMaxVoices(EShooterSoundCategory::Type Category)
+{
+	switch (Category)
+	{
+		case EShooterSoundCategory::Weapon:		return ShooterAudioMaxWeaponVoices;
+		case EShooterSoundCategory::Impact:		return ShooterAudioMaxImpactVoices;
+		case EShooterSoundCategory::Movement:	return ShooterAudioMaxMovementVoices;
+		case EShooterSoundCategory::Player:		return ShooterAudioMaxPlayerVoices;
+		default:								return 0;
+	}
+}
+
+const TCHAR* FShooterAudioManager::GetCategoryName(EShooterSoundCategory::Type Category)
+{
+	switch (Category)
+	{
+		case EShooterSoundCategory::Weapon:		return TEXT("Weapon");
+		case EShooterSoundCategory::Impact:		return TEXT("Impact");
+		case EShooterSoundCategory::Movement:	return TEXT("Movement");
+		case EShooterSoundCategory::Player:		return TEXT("Player");
+		default:								return TEXT("Unknown");
+	}
+}
+
+void FShooterAudioManager::UpdateListeners()
+{
+	if (LastListenerFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	LastListenerFrame = GFrameCounter;
+	ListenerLocations.Reset();
+
+	UWorld* MyWorld = World.Get();
+	if (MyWorld == NULL)
+	{
+		return;
+	}
+
+	for (FConstPlayerControllerIterator It = MyWorld->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController())
+		{
+			FVector Location, FrontDir, RightDir;
+			PC->GetAudioListenerPosition(Location, FrontDir, RightDir);
+			ListenerLocations.Add(Location);
+		}
+	}
+}
+
+float FShooterAudioManager::GetListenerDistanceSq(const FVector& Location) const
+{
+	// no listener yet, treat every sound as close
+	float DistanceSq = ListenerLocations.Num() > 0 ? MAX_FLT : 0.0f;
+	for (const FVector& ListenerLocation : ListenerLocations)
+	{
+		DistanceSq = FMath::Min(DistanceSq, FVector::DistSquared(ListenerLocation, Location));
+	}
+
+	return DistanceSq;
+}
+
+float FShooterAudioManager::GetPriority(EShooterSoundCategory::Type Category, const FVector& Location) const
+{
+	const float Distance = FMath::Sqrt(GetListenerDistanceSq(Location));
+	return ShooterAudioCategoryWeights[Category] / (1.0f + Distance / FMath::Max(ShooterAudioPriorityDistance, 1.0f));
+}
+
+int32 FShooterAudioManager::FindVoiceToSteal(EShooterSoundCategory::Type Category, float Priority) const
+{
+	int32 BestIdx = INDEX_NONE;
+	float BestPriority = Priority;
+	for (int32 Idx = 0; Idx < Voices.Num(); Idx++)
+	{
+		const FVoice& Voice = Voices[Idx];
+		if (Voice.bInUse && Voice.Priority < BestPriority && (Category == EShooterSoundCategory::MAX || Voice.Category == Category) && Voice.Component->IsPlaying())
+		{
+			BestIdx = Idx;
+			BestPriority = Voice.Priority;
+		}
+	}
+
+	return BestIdx;
+}
+
+void FShooterAudioManager::StealVoice(int32 VoiceIdx)
+{
+	FVoice& Voice = Voices[VoiceIdx];
+	Voice.Component->Stop();
+
+	NumActiveVoices[Voice.Category]--;
+	Stats[Voice.Category].NumStolen++;
+
+	// retained component stays with its owner, which sees it stopped
+	if (!Voice.bRetained)
+	{
+		Voice.Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+		Voice.bInUse = false;
+	}
+}
+
+int32 FShooterAudioManager::AcquireVoice()
+{
+	for (int32 Idx = 0; Idx < Voices.Num(); Idx++)
+	{
+		if (!Voices[Idx].bInUse && Voices[Idx].Component && !Voices[Idx].Component->IsPendingKill())
+		{
+			return Idx;
+		}
+	}
+
+	UWorld* MyWorld = World.Get();
+	UAudioComponent* Component = NewObject<UAudioComponent>(MyWorld);
+	Component->bAutoDestroy = false;
+	Component->bAllowAnyoneToDestroyMe = true;
+	Component->RegisterComponentWithWorld(MyWorld);
+
+	FVoice& Voice = Voices.AddZeroed_GetRef();
+	Voice.Component = Component;
+	return Voices.Num() - 1;
+}
+
+int32 FShooterAudioManager::FindVoice(const UAudioComponent* AudioComponent) const
+{
+	return Voices.IndexOfByPredicate([AudioComponent](const FVoice& Voice) { return Voice.Component == AudioComponent; });
+}
+
+UAudioComponent* FShooterAudioManager::PlaySound(EShooterSoundCategory::Type Category, USoundBase* Sound, USceneComponent* AttachTo, const FVector& Location, bool bRetain)
+{
+	UWorld* MyWorld = World.Get();
+	if (Sound == NULL || MyWorld == NULL || MyWorld->GetNetMode() == NM_DedicatedServer || !GEngine->UseSound())
+	{
+		return NULL;
+	}
+
+	UpdateListeners();
+
+	const FVector SoundLocation = AttachTo ? AttachTo->GetComponentLocation() : Location;
+	if (GetListenerDistanceSq(SoundLocation) > FMath::Square(Sound->GetMaxDistance()))
+	{
+		Stats[Category].NumDropped++;
+		return NULL;
+	}
+
+	const float Priority = GetPriority(Category, SoundLocation);
+
+	int32 NumVoices = 0;
+	for (int32 Idx = 0; Idx < EShooterSoundCategory::MAX; Idx++)
+	{
+		NumVoices += NumActiveVoices[Idx];
+	}
+
+	// category limit first, so one category can't drain the global budget
+	const bool bCategoryFull = NumActiveVoices[Category] >= GetMaxVoices(Category);
+	if (bCategoryFull || NumVoices >= ShooterAudioMaxVoices)
+	{
+		const int32 StealIdx = FindVoiceToSteal(bCategoryFull ? Category : EShooterSoundCategory::MAX, Priority);
+		if (StealIdx == INDEX_NONE)
+		{
+			Stats[Category].NumDropped++;
+			return NULL;
+		}
+
+		StealVoice(StealIdx);
+	}
+
+	const int32 VoiceIdx = AcquireVoice();
+	FVoice& Voice = Voices[VoiceIdx];
+	Voice.AttachedTo = AttachTo;
+	Voice.Category = Category;
+	Voice.Priority = Priority;
+	Voice.bInUse = true;
+	Voice.bRetained = bRetain;
+	Voice.bAttached = AttachTo != NULL;
+
+	UAudioComponent* Component = Voice.Component;
+	if (AttachTo)
+	{
+		Component->AttachToComponent(AttachTo, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	}
+	else
+	{
+		Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+		Component->SetWorldLocation(Location);
+	}
+
+	Component->SetSound(Sound);
+	Component->SetVolumeMultiplier(1.0f);
+	Component->SetPitchMultiplier(1.0f);
+	Component->Play();
+
+	NumActiveVoices[Category]++;
+	Stats[Category].NumPlayed++;
+
+	return Component;
+}
+
+bool FShooterAudioManager::ReleaseSound(UAudioComponent* AudioComponent, float FadeOutTime)
+{
+	const int32 VoiceIdx = FindVoice(AudioComponent);
+	if (VoiceIdx == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// component goes back to pool in tick, once it stops playing
+	FVoice& Voice = Voices[VoiceIdx];
+	Voice.bRetained = false;
+	if (FadeOutTime > 0.0f && AudioComponent->IsPlaying())
+	{
+		AudioComponent->FadeOut(FadeOutTime, 0.0f);
+	}
+	else
+	{
+		AudioComponent->Stop();
+	}
+
+	return true;
+}
+
+void FShooterAudioManager::Tick()
+{
+	if (Voices.Num() == 0)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ShooterAudioManager_Tick);
+
+	UpdateListeners();
+	FMemory::Memzero(NumActiveVoices);
+
+	for (int32 Idx = Voices.Num() - 1; Idx >= 0; Idx--)
+	{
+		FVoice& Voice = Voices[Idx];
+		if (Voice.Component == NULL || Voice.Component->IsPendingKill())
+		{
+			Voices.RemoveAtSwap(Idx, 1, false);
+			continue;
+		}
+
+		if (!Voice.bInUse)
+		{
+			continue;
+		}
+
+		// owner of attach parent is gone, nobody will release the sound
+		USceneComponent* AttachedTo = Voice.AttachedTo.Get();
+		if (Voice.bAttached && (AttachedTo == NULL || AttachedTo->IsPendingKill() || (AttachedTo->GetOwner() && AttachedTo->GetOwner()->IsPendingKillPending())))
+		{
+			Voice.Component->Stop();
+			Voice.bRetained = false;
+		}
+
+		if (Voice.Component->IsPlaying())
+		{
+			Voice.Priority = GetPriority(Voice.Category, Voice.Component->GetComponentLocation());
+			NumActiveVoices[Voice.Category]++;
+		}
+		else if (!Voice.bRetained)
+		{
+			Voice.Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+			Voice.bInUse = false;
+		}
+	}
+}
+
+UAudioComponent* FShooterAudioManager::SpawnSoundAttached(EShooterSoundCategory::Type Category, USoundBase* Sound, USceneComponent* AttachTo, bool bRetain)
+{
+	if (Sound == NULL || AttachTo == NULL)
+	{
+		return NULL;
+	}
+
+	FShooterAudioManager* AudioManager = ShooterAudioVoiceBudget > 0 ? Get(AttachTo) : NULL;
+	if (AudioManager)
+	{
+		return AudioManager->PlaySound(Category, Sound, AttachTo, FVector::ZeroVector, bRetain);
+	}
+
+	UAudioComponent* AudioComponent = UGameplayStatics::SpawnSoundAttached(Sound, AttachTo);
+	if (AudioComponent && bRetain)
+	{
+		AudioComponent->bAutoDestroy = false;
+	}
+
+	return AudioComponent;
+}
+
+void FShooterAudioManager::PlaySoundAtLocation(const UObject* WorldContextObject, EShooterSoundCategory::Type Category, USoundBase* Sound, const FVector& Location)
+{
+	if (Sound == NULL)
+	{
+		return;
+	}
+
+	FShooterAudioManager* AudioManager = ShooterAudioVoiceBudget > 0 ? Get(WorldContextObject) : NULL;
+	if (AudioManager)
+	{
+		AudioManager->PlaySound(Category, Sound, NULL, Location, false);
+	}
+	else
+	{
+		UGameplayStatics::PlaySoundAtLocation(WorldContextObject, Sound, Location);
+	}
+}
+
+void FShooterAudioManager::StopSound(UAudioComponent*& AudioComponent, float FadeOutTime)
+{
+	if (AudioComponent == NULL)
+	{
+		return;
+	}
+
+	FShooterAudioManager* AudioManager = Get(AudioComponent);
+	if (AudioManager == NULL || !AudioManager->ReleaseSound(AudioComponent, FadeOutTime))
+	{
+		// spawned without manager, let it destroy itself
+		AudioComponent->bAutoDestroy = true;
+		if (FadeOutTime > 0.0f && AudioComponent->IsPlaying())
+		{
+			AudioComponent->FadeOut(FadeOutTime, 0.0f);
+		}
+		else
+		{
+			AudioComponent->Stop();
+		}
+	}
+
+	AudioComponent = NULL;
+}
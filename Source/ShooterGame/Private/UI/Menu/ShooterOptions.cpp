@@ -347,6 +347,7 @@ void FShooterOptions::FreezeTimerOptionChanged(TSharedPtr<FShooterMenuItem> Menu
 	if (GameState)
 	{
 		GameState->bTimerPaused = MultiOptionIndex > 0  ? true : false;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterGameState, bTimerPaused, GameState);
 	}
 }
 
@@ -12,6 +12,8 @@
 #include "Misc/NetworkVersion.h"
 #include "OnlineSubsystemUtils.h"
 
+DECLARE_CYCLE_STAT(TEXT("HUD Draw"), STAT_ShooterHUDDraw, STATGROUP_ShooterGame);
+
 #define LOCTEXT_NAMESPACE "ShooterGame.HUD.Menu"
 
 const float AShooterHUD::MinHudScale = 0.5f;
@@ -488,6 +490,9 @@ void AShooterHUD::NotifyEnemyHit()
 
 void AShooterHUD::DrawHUD()
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterHUDDraw, ShooterUI, DrawHUD);
+	SHOOTER_LLM_SCOPE(UI);
+
 	Super::DrawHUD();
 	if (Canvas == nullptr)
 	{
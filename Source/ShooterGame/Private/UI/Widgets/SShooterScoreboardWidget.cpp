@@ -7,6 +7,9 @@
 #include "ShooterUIHelpers.h"
 #include "Online/ShooterPlayerState.h"
 
+DECLARE_CYCLE_STAT(TEXT("Scoreboard Tick"), STAT_ShooterScoreboardTick, STATGROUP_ShooterGame);
+DECLARE_CYCLE_STAT(TEXT("Scoreboard Update Players"), STAT_ShooterScoreboardUpdatePlayers, STATGROUP_ShooterGame);
+
 #define LOCTEXT_NAMESPACE "ShooterScoreboard"
 
 // @todo: prevent interaction on PC for now (see OnFocusReceived for reasons)
@@ -278,6 +281,8 @@ void SShooterScoreboardWidget::UpdateScoreboardGrid()
 
 void SShooterScoreboardWidget::UpdatePlayerStateMaps()
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterScoreboardUpdatePlayers, ShooterUI, ScoreboardUpdatePlayers);
+
 	if (PCOwner.IsValid())
 	{
 		AShooterGameState* const GameState = PCOwner->GetWorld()->GetGameState<AShooterGameState>();
@@ -316,6 +321,9 @@ void SShooterScoreboardWidget::UpdatePlayerStateMaps()
 
 void SShooterScoreboardWidget::Tick( const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime )
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterScoreboardTick, ShooterUI, ScoreboardTick);
+	SHOOTER_LLM_SCOPE(UI);
+
 	UpdatePlayerStateMaps();
 }
 
@@ -4,6 +4,14 @@
 #include "Weapons/ShooterProjectile.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "Effects/ShooterExplosionEffect.h"
+#include "Weapons/ShooterProjectileManager.h"
+
+static float ShooterProjectilePredictionBlendTime = 0.15f;
+FAutoConsoleVariableRef CVarShooterProjectilePredictionBlendTime(
+	TEXT("ShooterProjectile.PredictionBlendTime"),
+	ShooterProjectilePredictionBlendTime,
+	TEXT("Time (s) for replicated projectile to blend from location of its prediction to its own trajectory."),
+	ECVF_Default);
 
 AShooterProjectile::AShooterProjectile(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
@@ -31,18 +39,29 @@ AShooterProjectile::AShooterProjectile(const FObjectInitializer& ObjectInitializ
 	MovementComp->MaxSpeed = 2000.0f;
 	MovementComp->bRotationFollowsVelocity = true;
 	MovementComp->ProjectileGravityScale = 0.f;
+	MovementComp->bAutoActivate = false;
 
-	PrimaryActorTick.bCanEverTick = true;
-	PrimaryActorTick.TickGroup = TG_PrePhysics;
+	// moved by projectile manager, movement component is only used when batched simulation is disabled
+	PrimaryActorTick.bCanEverTick = false;
 	SetRemoteRoleForBackwardsCompat(ROLE_SimulatedProxy);
 	bReplicates = true;
-	SetReplicatingMovement(true);
+
+	// clients simulate from launch info
+	SetReplicatingMovement(false);
+
+	bPredicted = false;
 }
 
 void AShooterProjectile::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
 	MovementComp->OnProjectileStop.AddDynamic(this, &AShooterProjectile::OnImpact);
+	InitFromOwner();
+}
+
+void AShooterProjectile::InitFromOwner()
+{
+	CollisionComp->MoveIgnoreActors.Reset();
 	CollisionComp->MoveIgnoreActors.Add(GetInstigator());
 
 	AShooterWeapon_Projectile* OwnerWeapon = Cast<AShooterWeapon_Projectile>(GetOwner());
@@ -55,16 +74,166 @@ void AShooterProjectile::PostInitializeComponents()
 	MyController = GetInstigatorController();
 }
 
+void AShooterProjectile::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (GetLocalRole() == ROLE_Authority)
+	{
+		// prewarmed projectiles wait in pool until fired
+		FShooterProjectilePool* Pool = FShooterProjectilePool::Get(this);
+		if (Pool == NULL || !Pool->IsInPool(this))
+		{
+			StartSimulation(0.0f);
+		}
+	}
+	else if (!bExploded && !IsHidden())
+	{
+		// catch up with server, limited so late joiners don't see rockets skip far ahead
+		AGameStateBase* const GameState = GetWorld()->GetGameState();
+		const float ForwardTime = FMath::Clamp(GameState ? GameState->GetServerWorldTimeSeconds() - LaunchInfo.LaunchTime : 0.0f, 0.0f, 0.5f);
+		StartSimulation(ForwardTime);
+		ReplacePrediction(ForwardTime);
+	}
+}
+
+void AShooterProjectile::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	StopSimulation();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AShooterProjectile::LifeSpanExpired()
+{
+	FShooterProjectilePool* Pool = FShooterProjectilePool::Get(this);
+	if (Pool == NULL || !Pool->ReleaseActor(this))
+	{
+		Super::LifeSpanExpired();
+	}
+}
+
+void AShooterProjectile::OnAcquiredFromPool()
+{
+	bExploded = false;
+	InitFromOwner();
+	RestartEffects();
+	StartSimulation(0.0f);
+}
+
+void AShooterProjectile::OnReleasedToPool()
+{
+	StopSimulation();
+
+	if (ParticleComp)
+	{
+		ParticleComp->DeactivateImmediate();
+	}
+
+	MyController = NULL;
+}
+
+void AShooterProjectile::RestartEffects()
+{
+	if (ParticleComp)
+	{
+		ParticleComp->Activate(true);
+	}
+
+	UAudioComponent* ProjAudioComp = FindComponentByClass<UAudioComponent>();
+	if (ProjAudioComp && ProjAudioComp->bAutoActivate)
+	{
+		ProjAudioComp->Play();
+	}
+}
+
 void AShooterProjectile::InitVelocity(FVector& ShootDirection)
 {
-	if (MovementComp)
+	AGameStateBase* const GameState = GetWorld()->GetGameState();
+
+	LaunchInfo.Origin = GetActorLocation();
+	LaunchInfo.Direction = ShootDirection;
+	LaunchInfo.LaunchTime = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+}
+
+void AShooterProjectile::SetShotId(uint8 InShotId, bool bInPredicted)
+{
+	LaunchInfo.ShotId = InShotId;
+	bPredicted = bInPredicted;
+}
+
+void AShooterProjectile::ReplacePrediction(float ForwardTime)
+{
+	AShooterWeapon_Projectile* OwnerWeapon = Cast<AShooterWeapon_Projectile>(GetOwner());
+	APawn* const MyPawn = GetInstigator();
+	if (LaunchInfo.ShotId == 0 || OwnerWeapon == NULL || MyPawn == NULL || !MyPawn->IsLocallyControlled())
+	{
+		return;
+	}
+
+	AShooterProjectile* Prediction = OwnerWeapon->TakePredictedProjectile(LaunchInfo.ShotId);
+	if (Prediction == NULL)
 	{
-		MovementComp->Velocity = ShootDirection * MovementComp->InitialSpeed;
+		return;
 	}
+
+	// prediction is ahead by the time request took to reach server, catch up visually instead of popping back
+	FShooterProjectileManager* Manager = FShooterProjectileManager::Get(this);
+	if (Manager && !Prediction->IsHidden())
+	{
+		const FVector SimulatedLocation = LaunchInfo.Origin + LaunchInfo.Direction * MovementComp->InitialSpeed * ForwardTime;
+		Manager->SetVisualOffset(this, Prediction->GetActorLocation() - SimulatedLocation, ShooterProjectilePredictionBlendTime);
+	}
+
+	Prediction->Destroy();
+}
+
+void AShooterProjectile::StartSimulation(float ForwardTime)
+{
+	const FVector Velocity = LaunchInfo.Direction * MovementComp->InitialSpeed;
+	SetActorLocationAndRotation(LaunchInfo.Origin, Velocity.Rotation());
+
+	FShooterProjectileManager* Manager = FShooterProjectileManager::Get(this);
+	if (Manager && FShooterProjectileManager::IsEnabled())
+	{
+		Manager->AddProjectile(this, LaunchInfo.Origin, Velocity, MovementComp->MaxSpeed, MovementComp->ProjectileGravityScale, ForwardTime);
+	}
+	else
+	{
+		// movement clears updated component when it stops on impact
+		MovementComp->SetUpdatedComponent(CollisionComp);
+		MovementComp->Velocity = Velocity;
+		MovementComp->Activate(true);
+	}
+}
+
+void AShooterProjectile::StopSimulation()
+{
+	FShooterProjectileManager* Manager = FShooterProjectileManager::Get(this);
+	if (Manager)
+	{
+		Manager->RemoveProjectile(this);
+	}
+
+	MovementComp->StopMovementImmediately();
+	MovementComp->Deactivate();
 }
 
 void AShooterProjectile::OnImpact(const FHitResult& HitResult)
 {
+	StopSimulation();
+
+	if (bPredicted)
+	{
+		// explosion is up to server, prediction just waits to be replaced
+		SetActorHiddenInGame(true);
+		if (ParticleComp)
+		{
+			ParticleComp->Deactivate();
+		}
+		return;
+	}
+
 	if (GetLocalRole() == ROLE_Authority && !bExploded)
 	{
 		Explode(HitResult);
@@ -79,12 +248,27 @@ void AShooterProjectile::Explode(const FHitResult& Impact)
 		ParticleComp->Deactivate();
 	}
 
+	if (GetLocalRole() == ROLE_Authority)
+	{
+		ImpactLocation = Impact.ImpactPoint;
+		ImpactNormal = Impact.ImpactNormal;
+	}
+
 	// effects and damage origin shouldn't be placed inside mesh at impact point
 	const FVector NudgedImpactLocation = Impact.ImpactPoint + Impact.ImpactNormal * 10.0f;
 
-	if (WeaponConfig.ExplosionDamage > 0 && WeaponConfig.ExplosionRadius > 0 && WeaponConfig.DamageType)
+	AShooterGameMode* GameMode = GetWorld()->GetAuthGameMode<AShooterGameMode>();
+	if (GameMode && WeaponConfig.ExplosionDamage > 0 && WeaponConfig.ExplosionRadius > 0 && WeaponConfig.DamageType)
 	{
-		UGameplayStatics::ApplyRadialDamage(this, WeaponConfig.ExplosionDamage, NudgedImpactLocation, WeaponConfig.ExplosionRadius, WeaponConfig.DamageType, TArray<AActor*>(), this, MyController.Get());
+		FShooterRadialDamageParams DamageParams;
+		DamageParams.Origin = NudgedImpactLocation;
+		DamageParams.Radius = WeaponConfig.ExplosionRadius;
+		DamageParams.BaseDamage = WeaponConfig.ExplosionDamage;
+		DamageParams.DamageTypeClass = WeaponConfig.DamageType;
+		DamageParams.DamageCauser = this;
+		DamageParams.EventInstigator = MyController;
+
+		GameMode->GetRadialDamageService().ApplyRadialDamage(DamageParams);
 	}
 
 	if (ExplosionTemplate)
@@ -109,43 +293,55 @@ void AShooterProjectile::DisableAndDestroy()
 		ProjAudioComp->FadeOut(0.1f, 0.f);
 	}
 
-	MovementComp->StopMovementImmediately();
+	StopSimulation();
 
 	// give clients some time to show explosion
 	SetLifeSpan( 2.0f );
 }
 
-///CODE_SNIPPET_START: AActor::GetActorLocation AActor::GetActorRotation
+void AShooterProjectile::OnRep_LaunchInfo()
+{
+	// first launch is started by BeginPlay
+	if (HasActorBegunPlay() && !bExploded)
+	{
+		RestartEffects();
+		StartSimulation(0.0f);
+		ReplacePrediction(0.0f);
+	}
+}
+
 void AShooterProjectile::OnRep_Exploded()
 {
-	FVector ProjDirection = GetActorForwardVector();
+	if (!bExploded)
+	{
+		// reused from pool, OnRep_LaunchInfo restarts it
+		return;
+	}
 
-	const FVector StartTrace = GetActorLocation() - ProjDirection * 200;
-	const FVector EndTrace = GetActorLocation() + ProjDirection * 150;
+	StopSimulation();
+	SetActorLocation(ImpactLocation);
+
+	// explode where server did, trace only to find surface for effects
+	const FVector StartTrace = ImpactLocation + ImpactNormal * 50.0f;
+	const FVector EndTrace = ImpactLocation - ImpactNormal * 50.0f;
 	FHitResult Impact;
 	
 	if (!GetWorld()->LineTraceSingleByChannel(Impact, StartTrace, EndTrace, COLLISION_PROJECTILE, FCollisionQueryParams(SCENE_QUERY_STAT(ProjClient), true, GetInstigator())))
 	{
 		// failsafe
-		Impact.ImpactPoint = GetActorLocation();
-		Impact.ImpactNormal = -ProjDirection;
+		Impact.ImpactPoint = ImpactLocation;
+		Impact.ImpactNormal = ImpactNormal;
 	}
 
 	Explode(Impact);
 }
-///CODE_SNIPPET_END
-
-void AShooterProjectile::PostNetReceiveVelocity(const FVector& NewVelocity)
-{
-	if (MovementComp)
-	{
-		MovementComp->Velocity = NewVelocity;
-	}
-}
 
 void AShooterProjectile::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & OutLifetimeProps ) const
 {
 	Super::GetLifetimeReplicatedProps( OutLifetimeProps );
 	
+	DOREPLIFETIME( AShooterProjectile, LaunchInfo );
 	DOREPLIFETIME( AShooterProjectile, bExploded );
+	DOREPLIFETIME( AShooterProjectile, ImpactLocation );
+	DOREPLIFETIME( AShooterProjectile, ImpactNormal );
 }
\ No newline at end of file
@@ -0,0 +1,177 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Weapons/ShooterProjectileManager.h"
+#include "Weapons/ShooterProjectile.h"
+
+static int32 ShooterProjectileBatchedSimulation = 1;
+FAutoConsoleVariableRef CVarShooterProjectileBatchedSimulation(
+	TEXT("ShooterProjectile.BatchedSimulation"),
+	ShooterProjectileBatchedSimulation,
+	TEXT("Move projectiles in a single batched tick instead of a movement component each. Applies to newly fired projectiles.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+FShooterProjectileManager::FShooterProjectileManager()
+{
+}
+
+void FShooterProjectileManager::Initialize(UWorld* InWorld)
+{
+	World = InWorld;
+}
+
+FShooterProjectileManager* FShooterProjectileManager::Get(const UObject* WorldContextObject)
+{
+	UWorld* MyWorld = WorldContextObject ? WorldContextObject->GetWorld() : NULL;
+	AShooterGameState* GameState = MyWorld ? MyWorld->GetGameState<AShooterGameState>() : NULL;
+	return GameState ? &GameState->GetProjectileManager() : NULL;
+}
+
+bool FShooterProjectileManager::IsEnabled()
+{
+	return ShooterProjectileBatchedSimulation > 0;
+}
+
+void FShooterProjectileManager::AddProjectile(AShooterProjectile* Projectile, const FVector& Location, const FVector& Velocity, float MaxSpeed, float GravityScale, float ForwardTime)
+{
+	USphereComponent* CollisionComp = Projectile ? Projectile->FindComponentByClass<USphereComponent>() : NULL;
+	if (CollisionComp == NULL)
+	{
+		return;
+	}
+
+	RemoveProjectile(Projectile);
+
+	Projectiles.Add(Projectile);
+	Locations.Add(Location);
+	Velocities.Add(Velocity);
+	MaxSpeeds.Add(MaxSpeed);
+	GravityScales.Add(GravityScale);
+	ForwardTimes.Add(ForwardTime);
+	Radii.Add(CollisionComp->GetScaledSphereRadius());
+	Channels.Add(CollisionComp->GetCollisionObjectType());
+	Responses.Add(CollisionComp->GetCollisionResponseToChannels());
+	Instigators.Add(Projectile->GetInstigator());
+	VisualOffsets.Add(FVector::ZeroVector);
+	VisualBlendTimes.Add(FVector2D::ZeroVector);
+}
+
+void FShooterProjectileManager::SetVisualOffset(AShooterProjectile* Projectile, const FVector& Offset, float BlendTime)
+{
+	const int32 Index = Projectiles.IndexOfByKey(Projectile);
+	if (Index != INDEX_NONE && BlendTime > 0.0f)
+	{
+		VisualOffsets[Index] = Offset;
+		VisualBlendTimes[Index] = FVector2D(BlendTime, BlendTime);
+	}
+}
+
+void FShooterProjectileManager::RemoveProjectile(AShooterProjectile* Projectile)
+{
+	const int32 Index = Projectiles.IndexOfByKey(Projectile);
+	if (Index != INDEX_NONE)
+	{
+		RemoveAtSwap(Index);
+	}
+}
+
+void FShooterProjectileManager::RemoveAtSwap(int32 Index)
+{
+	Projectiles.RemoveAtSwap(Index, 1, false);
+	Locations.RemoveAtSwap(Index, 1, false);
+	Velocities.RemoveAtSwap(Index, 1, false);
+	MaxSpeeds.RemoveAtSwap(Index, 1, false);
+	GravityScales.RemoveAtSwap(Index, 1, false);
+	ForwardTimes.RemoveAtSwap(Index, 1, false);
+	Radii.RemoveAtSwap(Index, 1, false);
+	Channels.RemoveAtSwap(Index, 1, false);
+	Responses.RemoveAtSwap(Index, 1, false);
+	Instigators.RemoveAtSwap(Index, 1, false);
+	VisualOffsets.RemoveAtSwap(Index, 1, false);
+	VisualBlendTimes.RemoveAtSwap(Index, 1, false);
+}
+
+void FShooterProjectileManager::Tick(float DeltaSeconds)
+{
+	UWorld* MyWorld = World.Get();
+	if (MyWorld == NULL || Projectiles.Num() == 0)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ShooterProjectileManager_Tick);
+
+	// drop projectiles destroyed without being removed
+	for (int32 Idx = Projectiles.Num() - 1; Idx >= 0; Idx--)
+	{
+		if (!Projectiles[Idx].IsValid())
+		{
+			RemoveAtSwap(Idx);
+		}
+	}
+
+	const int32 NumProjectiles = Projectiles.Num();
+	const float GravityZ = MyWorld->GetGravityZ();
+
+	// integrate all projectiles first, memory access stays linear
+	TArray<FVector> NewLocations;
+	NewLocations.SetNumUninitialized(NumProjectiles);
+	for (int32 Idx = 0; Idx < NumProjectiles; Idx++)
+	{
+		const float StepTime = DeltaSeconds + ForwardTimes[Idx];
+		ForwardTimes[Idx] = 0.0f;
+
+		const FVector OldVelocity = Velocities[Idx];
+		FVector NewVelocity = OldVelocity + FVector(0.0f, 0.0f, GravityZ * GravityScales[Idx] * StepTime);
+		if (MaxSpeeds[Idx] > 0.0f)
+		{
+			NewVelocity = NewVelocity.GetClampedToMaxSize(MaxSpeeds[Idx]);
+		}
+
+		Velocities[Idx] = NewVelocity;
+		NewLocations[Idx] = Locations[Idx] + (OldVelocity + NewVelocity) * 0.5f * StepTime;
+	}
+
+	// sweep all projectiles, hits are dispatched afterwards since impacts may remove projectiles
+	TArray<TPair<TWeakObjectPtr<AShooterProjectile>, FHitResult>> Impacts;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ShooterProjectileManager), true);
+	for (int32 Idx = 0; Idx < NumProjectiles; Idx++)
+	{
+		AShooterProjectile* Projectile = Projectiles[Idx].Get();
+
+		QueryParams.ClearIgnoredActors();
+		QueryParams.AddIgnoredActor(Projectile);
+		QueryParams.AddIgnoredActor(Instigators[Idx].Get());
+
+		FHitResult Hit;
+		if (MyWorld->SweepSingleByChannel(Hit, Locations[Idx], NewLocations[Idx], FQuat::Identity, Channels[Idx],
+			FCollisionShape::MakeSphere(Radii[Idx]), QueryParams, FCollisionResponseParams(Responses[Idx])))
+		{
+			NewLocations[Idx] = Hit.Location;
+			Impacts.Emplace(Projectile, Hit);
+		}
+
+		Locations[Idx] = NewLocations[Idx];
+
+		// predicted projectiles replaced by replicated ones fade into the simulated trajectory
+		FVector DisplayLocation = NewLocations[Idx];
+		FVector2D& BlendTime = VisualBlendTimes[Idx];
+		if (BlendTime.X > 0.0f)
+		{
+			BlendTime.X = FMath::Max(BlendTime.X - DeltaSeconds, 0.0f);
+			DisplayLocation += VisualOffsets[Idx] * (BlendTime.X / BlendTime.Y);
+		}
+
+		Projectile->SetActorLocationAndRotation(DisplayLocation, Velocities[Idx].Rotation(), false, NULL, ETeleportType::None);
+	}
+
+	for (const TPair<TWeakObjectPtr<AShooterProjectile>, FHitResult>& Impact : Impacts)
+	{
+		if (AShooterProjectile* Projectile = Impact.Key.Get())
+		{
+			RemoveProjectile(Projectile);
+			Projectile->OnImpact(Impact.Value);
+		}
+	}
+}
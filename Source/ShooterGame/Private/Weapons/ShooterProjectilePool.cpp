@@ -0,0 +1,234 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Weapons/ShooterProjectilePool.h"
+
+static int32 ShooterPoolEnable = 1;
+FAutoConsoleVariableRef CVarShooterPoolEnable(
+	TEXT("ShooterPool.Enable"),
+	ShooterPoolEnable,
+	TEXT("Reuse projectiles and grenades instead of spawning and destroying them.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+static int32 ShooterPoolPrewarmCount = 8;
+FAutoConsoleVariableRef CVarShooterPoolPrewarmCount(
+	TEXT("ShooterPool.PrewarmCount"),
+	ShooterPoolPrewarmCount,
+	TEXT("Instances created up front for each pooled class."),
+	ECVF_Default);
+
+static int32 ShooterPoolMaxPerClass = 32;
+FAutoConsoleVariableRef CVarShooterPoolMaxPerClass(
+	TEXT("ShooterPool.MaxPerClass"),
+	ShooterPoolMaxPerClass,
+	TEXT("Max inactive instances kept for each class, others are destroyed."),
+	ECVF_Default);
+
+UShooterPoolableActor::UShooterPoolableActor(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+}
+
+FShooterProjectilePool::FShooterProjectilePool()
+	: NumGarbageCollections(0)
+	, GarbageCollectionTimeMs(0.0)
+	, GarbageCollectionStartTime(0.0)
+{
+}
+
+FShooterProjectilePool::~FShooterProjectilePool()
+{
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+}
+
+void FShooterProjectilePool::Initialize(UWorld* InWorld)
+{
+	World = InWorld;
+
+	if (!PreGarbageCollectHandle.IsValid())
+	{
+		PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddRaw(this, &FShooterProjectilePool::OnPreGarbageCollect);
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FShooterProjectilePool::OnPostGarbageCollect);
+	}
+}
+
+FShooterProjectilePool* FShooterProjectilePool::Get(const UObject* WorldContextObject)
+{
+	UWorld* MyWorld = WorldContextObject ? WorldContextObject->GetWorld() : NULL;
+	AShooterGameMode* GameMode = MyWorld ? MyWorld->GetAuthGameMode<AShooterGameMode>() : NULL;
+	return GameMode ? &GameMode->GetProjectilePool() : NULL;
+}
+
+AActor* FShooterProjectilePool::SpawnActor(UClass* Class, const FTransform& Transform, AActor* Owner, APawn* Instigator, TFunctionRef<void(AActor*)> InitFunc)
+{
+	if (Class == NULL || World.Get() == NULL)
+	{
+		return NULL;
+	}
+
+	FClassPool& ClassPool = ClassPools.FindOrAdd(Class);
+	while (ShooterPoolEnable && ClassPool.FreeActors.Num() > 0)
+	{
+		AActor* Actor = ClassPool.FreeActors.Pop(false).Get();
+		if (Actor == NULL || Actor->IsPendingKillPending())
+		{
+			ClassPool.NumInstances--;
+			continue;
+		}
+
+		Actor->SetOwner(Owner);
+		Actor->SetInstigator(Instigator);
+		Actor->SetActorTransform(Transform, false, NULL, ETeleportType::ResetPhysics);
+		Actor->SetActorHiddenInGame(false);
+		Actor->SetActorEnableCollision(true);
+		Actor->SetActorTickEnabled(true);
+		Actor->SetNetDormancy(DORM_Awake);
+
+		InitFunc(Actor);
+
+		CastChecked<IShooterPoolableActor>(Actor)->OnAcquiredFromPool();
+		Actor->ForceNetUpdate();
+
+		ClassPool.NumHits++;
+		return Actor;
+	}
+
+	ClassPool.NumMisses++;
+	return CreateActor(ClassPool, Class, Transform, Owner, Instigator, InitFunc);
+}
+
+AActor* FShooterProjectilePool::CreateActor(FClassPool& ClassPool, UClass* Class, const FTransform& Transform, AActor* Owner, APawn* Instigator, TFunctionRef<void(AActor*)> InitFunc)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	AActor* Actor = World->SpawnActorDeferred<AActor>(Class, Transform, Owner, Instigator);
+	if (Actor)
+	{
+		InitFunc(Actor);
+		UGameplayStatics::FinishSpawningActor(Actor, Transform);
+
+		ClassPool.NumInstances++;
+		ClassPool.NumSpawned++;
+		ClassPool.SpawnTimeMs += (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		if (ClassPool.NumObjectsPerActor == 0)
+		{
+			TArray<UObject*> Subobjects;
+			GetObjectsWithOuter(Actor, Subobjects, true);
+			ClassPool.NumObjectsPerActor = Subobjects.Num() + 1;
+		}
+	}
+
+	return Actor;
+}
+
+bool FShooterProjectilePool::ReleaseActor(AActor* Actor)
+{
+	IShooterPoolableActor* PoolableActor = Cast<IShooterPoolableActor>(Actor);
+	if (PoolableActor == NULL || Actor->GetWorld() != World.Get() || Actor->IsPendingKillPending())
+	{
+		return false;
+	}
+
+	FClassPool& ClassPool = ClassPools.FindOrAdd(Actor->GetClass());
+	if (!ShooterPoolEnable || ClassPool.FreeActors.Num() >= ShooterPoolMaxPerClass)
+	{
+		ClassPool.NumInstances--;
+		return false;
+	}
+
+	PoolableActor->OnReleasedToPool();
+	DeactivateActor(Actor);
+
+	ClassPool.FreeActors.Add(Actor);
+	return true;
+}
+
+void FShooterProjectilePool::DeactivateActor(AActor* Actor)
+{
+	Actor->SetLifeSpan(0.0f);
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+
+	// hidden state is sent before channel closes, clients keep their copy until reuse
+	Actor->SetNetDormancy(DORM_DormantAll);
+}
+
+bool FShooterProjectilePool::IsInPool(const AActor* Actor) const
+{
+	const FClassPool* ClassPool = Actor ? ClassPools.Find(Actor->GetClass()) : NULL;
+	return ClassPool && ClassPool->FreeActors.Contains(Actor);
+}
+
+void FShooterProjectilePool::Prewarm(UClass* Class, int32 Count)
+{
+	if (!ShooterPoolEnable || Class == NULL || World.Get() == NULL || !Class->ImplementsInterface(UShooterPoolableActor::StaticClass()))
+	{
+		return;
+	}
+
+	Count = FMath::Min(Count < 0 ? ShooterPoolPrewarmCount : Count, ShooterPoolMaxPerClass);
+
+	FClassPool& ClassPool = ClassPools.FindOrAdd(Class);
+	while (ClassPool.NumInstances < Count)
+	{
+		// in pool before BeginPlay, so actors can skip their gameplay setup
+		AActor* Actor = CreateActor(ClassPool, Class, FTransform::Identity, NULL, NULL, [&ClassPool](AActor* NewActor) { ClassPool.FreeActors.Add(NewActor); });
+		if (Actor == NULL)
+		{
+			break;
+		}
+
+		CastChecked<IShooterPoolableActor>(Actor)->OnReleasedToPool();
+		DeactivateActor(Actor);
+	}
+}
+
+void FShooterProjectilePool::GetStats(TArray<FString>& OutLines) const
+{
+	for (const auto& It : ClassPools)
+	{
+		const FClassPool& ClassPool = It.Value;
+		const int32 NumRequests = ClassPool.NumHits + ClassPool.NumMisses;
+		const double AvgSpawnMs = ClassPool.NumSpawned > 0 ? ClassPool.SpawnTimeMs / ClassPool.NumSpawned : 0.0;
+
+		OutLines.Add(FString::Printf(TEXT("%s: %d requests, hit rate %.1f%%, %d instances, %d free, spawn %.3f ms avg, saved %.2f ms and %d objects to collect"),
+			It.Key.IsValid() ? *It.Key->GetName() : TEXT("None"),
+			NumRequests,
+			NumRequests > 0 ? 100.0f * ClassPool.NumHits / NumRequests : 0.0f,
+			ClassPool.NumInstances,
+			ClassPool.FreeActors.Num(),
+			AvgSpawnMs,
+			AvgSpawnMs * ClassPool.NumHits,
+			ClassPool.NumObjectsPerActor * ClassPool.NumHits));
+	}
+
+	// compare against ShooterPool.Enable 0 over the same scenario to see the difference in GC cost
+	OutLines.Add(FString::Printf(TEXT("Garbage collection: %d passes, %.2f ms total, %.2f ms avg"),
+		NumGarbageCollections, GarbageCollectionTimeMs, NumGarbageCollections > 0 ? GarbageCollectionTimeMs / NumGarbageCollections : 0.0));
+}
+
+void FShooterProjectilePool::ResetStats()
+{
+	for (auto& It : ClassPools)
+	{
+		It.Value.NumHits = 0;
+		It.Value.NumMisses = 0;
+	}
+
+	NumGarbageCollections = 0;
+	GarbageCollectionTimeMs = 0.0;
+}
+
+void FShooterProjectilePool::OnPreGarbageCollect()
+{
+	GarbageCollectionStartTime = FPlatformTime::Seconds();
+}
+
+void FShooterProjectilePool::OnPostGarbageCollect()
+{
+	NumGarbageCollections++;
+	GarbageCollectionTimeMs += (FPlatformTime::Seconds() - GarbageCollectionStartTime) * 1000.0;
+}
@@ -0,0 +1,314 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Weapons/ShooterRadialDamage.h"
+#include "Curves/CurveFloat.h"
+
+static int32 ShooterRadialDamageAsyncTraces = 1;
+FAutoConsoleVariableRef CVarShooterRadialDamageAsyncTraces(
+	TEXT("ShooterDamage.AsyncTraces"),
+	ShooterRadialDamageAsyncTraces,
+	TEXT("Run occlusion traces of explosions as async batch, damage is applied next frame.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+static float ShooterRadialDamageShareDistance = 100.0f;
+FAutoConsoleVariableRef CVarShooterRadialDamageShareDistance(
+	TEXT("ShooterDamage.ShareDistance"),
+	ShooterRadialDamageShareDistance,
+	TEXT("Explosions closer than this in the same frame share spatial query and occlusion traces."),
+	ECVF_Default);
+
+FShooterRadialDamageService::FShooterRadialDamageService()
+{
+}
+
+void FShooterRadialDamageService::Initialize(UWorld* InWorld)
+{
+	World = InWorld;
+}
+
+void FShooterRadialDamageService::ApplyRadialDamage(const FShooterRadialDamageParams& Params)
+{
+	if (Params.Radius > 0.0f)
+	{
+		QueuedExplosions.Add(Params);
+	}
+}
+
+float FShooterRadialDamageService::GetDamageAtDistance(const FShooterRadialDamageParams& Params, float Distance)
+{
+	if (Params.Radius <= 0.0f || Distance > Params.Radius)
+	{
+		return 0.0f;
+	}
+
+	if (const UCurveFloat* Curve = Params.DamageCurve.Get())
+	{
+		return Curve->GetFloatValue(Distance);
+	}
+
+	return Params.BaseDamage * (1.0f - Distance / Params.Radius);
+}
+
+void FShooterRadialDamageService::Tick()
+{
+	if (PendingBatches.Num() == 0 && QueuedExplosions.Num() == 0)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_ShooterRadialDamage_Tick);
+
+	// apply damage of batches with finished traces
+	for (int32 Idx = PendingBatches.Num() - 1; Idx >= 0; Idx--)
+	{
+		if (UpdateBatchTraces(PendingBatches[Idx]))
+		{
+			// damage can trigger new explosions, don't apply it while iterating
+			FBatch Batch = MoveTemp(PendingBatches[Idx]);
+			PendingBatches.RemoveAtSwap(Idx, 1, false);
+
+			ApplyBatchDamage(Batch);
+		}
+	}
+
+	if (QueuedExplosions.Num() == 0)
+	{
+		return;
+	}
+
+	// group explosions of this frame, so nearby ones share queries
+	TArray<FShooterRadialDamageParams> Explosions = MoveTemp(QueuedExplosions);
+	QueuedExplosions.Reset();
+
+	TArray<FBatch> NewBatches;
+	const float ShareDistanceSq = FMath::Square(ShooterRadialDamageShareDistance);
+	for (const FShooterRadialDamageParams& Explosion : Explosions)
+	{
+		FBatch* Batch = NewBatches.FindByPredicate([&](const FBatch& TestBatch)
+		{
+			return TestBatch.OcclusionChannel == Explosion.OcclusionChannel && FVector::DistSquared(TestBatch.Origin, Explosion.Origin) <= ShareDistanceSq;
+		});
+
+		if (Batch == NULL)
+		{
+			Batch = &NewBatches.AddDefaulted_GetRef();
+			Batch->Origin = Explosion.Origin;
+			Batch->Radius = 0.0f;
+			Batch->OcclusionChannel = Explosion.OcclusionChannel;
+		}
+
+		Batch->Radius = FMath::Max(Batch->Radius, Explosion.Radius + FVector::Dist(Batch->Origin, Explosion.Origin));
+		Batch->Explosions.Add(Explosion);
+	}
+
+	const bool bAsync = ShooterRadialDamageAsyncTraces > 0;
+	for (FBatch& Batch : NewBatches)
+	{
+		StartBatch(Batch, bAsync);
+
+		if (bAsync)
+		{
+			PendingBatches.Add(MoveTemp(Batch));
+		}
+		else
+		{
+			ApplyBatchDamage(Batch);
+		}
+	}
+}
+
+FCollisionQueryParams FShooterRadialDamageService::GetTraceParams(const FBatch& Batch) const
+{
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(ShooterRadialDamage), false);
+	for (const FShooterRadialDamageParams& Explosion : Batch.Explosions)
+	{
+		Params.AddIgnoredActor(Explosion.DamageCauser.Get());
+	}
+
+	return Params;
+}
+
+void FShooterRadialDamageService::StartBatch(FBatch& Batch, bool bAsync)
+{
+	UWorld* MyWorld = World.Get();
+	if (MyWorld == NULL)
+	{
+		return;
+	}
+
+	const FCollisionQueryParams Params = GetTraceParams(Batch);
+
+	TArray<FOverlapResult> Overlaps;
+	MyWorld->OverlapMultiByObjectType(Overlaps, Batch.Origin, FQuat::Identity,
+		FCollisionObjectQueryParams(FCollisionObjectQueryParams::InitType::AllDynamicObjects), FCollisionShape::MakeSphere(Batch.Radius), Params);
+
+	TSet<AActor*> GatheredActors;
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		AActor* Actor = Overlap.GetActor();
+		if (Actor == NULL || !Actor->CanBeDamaged())
+		{
+			continue;
+		}
+
+		// several components of one actor may overlap
+		bool bAlreadyGathered = false;
+		GatheredActors.Add(Actor, &bAlreadyGathered);
+		if (bAlreadyGathered)
+		{
+			continue;
+		}
+
+		FTarget& Target = Batch.Targets.AddDefaulted_GetRef();
+		Target.Actor = Actor;
+		Target.Component = Overlap.GetComponent();
+		Target.Location = Actor->GetActorLocation();
+		Target.bVisible = false;
+
+		if (bAsync)
+		{
+			Target.TraceHandle = MyWorld->AsyncLineTraceByChannel(EAsyncTraceType::Multi, Batch.Origin, Target.Location, Batch.OcclusionChannel, Params);
+		}
+		else
+		{
+			TArray<FHitResult> Hits;
+			MyWorld->LineTraceMultiByChannel(Hits, Batch.Origin, Target.Location, Batch.OcclusionChannel, Params);
+			Target.bVisible = IsTargetVisible(Hits, Actor);
+		}
+	}
+}
+
+bool FShooterRadialDamageService::UpdateBatchTraces(FBatch& Batch)
+{
+	UWorld* MyWorld = World.Get();
+	if (MyWorld == NULL)
+	{
+		return true;
+	}
+
+	bool bComplete = true;
+	for (FTarget& Target : Batch.Targets)
+	{
+		if (!Target.TraceHandle.IsValid())
+		{
+			continue;
+		}
+
+		FTraceDatum TraceData;
+		if (MyWorld->QueryTraceData(Target.TraceHandle, TraceData))
+		{
+			Target.bVisible = IsTargetVisible(TraceData.OutHits, Target.Actor.Get());
+			Target.TraceHandle = FTraceHandle();
+		}
+		else if (MyWorld->IsTraceHandleValid(Target.TraceHandle, false))
+		{
+			bComplete = false;
+		}
+		else
+		{
+			// results expired, trace again so damage isn't lost
+			TArray<FHitResult> Hits;
+			MyWorld->LineTraceMultiByChannel(Hits, Batch.Origin, Target.Location, Batch.OcclusionChannel, GetTraceParams(Batch));
+			Target.bVisible = IsTargetVisible(Hits, Target.Actor.Get());
+			Target.TraceHandle = FTraceHandle();
+		}
+	}
+
+	return bComplete;
+}
+
+bool FShooterRadialDamageService::IsTargetVisible(const TArray<FHitResult>& Hits, const AActor* Target)
+{
+	if (Target == NULL)
+	{
+		return false;
+	}
+
+	// hits are sorted by distance, other pawns don't give cover
+	for (const FHitResult& Hit : Hits)
+	{
+		AActor* HitActor = Hit.GetActor();
+		if (HitActor == Target)
+		{
+			return true;
+		}
+
+		if (Hit.bBlockingHit && (HitActor == NULL || !HitActor->IsA<APawn>()))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FShooterRadialDamageService::ApplyBatchDamage(const FBatch& Batch)
+{
+	for (const FShooterRadialDamageParams& Explosion : Batch.Explosions)
+	{
+		for (const FTarget& Target : Batch.Targets)
+		{
+			AActor* Actor = Target.Actor.Get();
+			if (!Target.bVisible || Actor == NULL || Actor == Explosion.DamageCauser.Get())
+			{
+				continue;
+			}
+
+			const float DamageAmount = GetDamageAtDistance(Explosion, FVector::Dist(Explosion.Origin, Target.Location));
+			if (DamageAmount <= 0.0f)
+			{
+				continue;
+			}
+
+			FRadialDamageEvent DamageEvent;
+			DamageEvent.DamageTypeClass = Explosion.DamageTypeClass ? Explosion.DamageTypeClass : TSubclassOf<UDamageType>(UDamageType::StaticClass());
+			DamageEvent.Origin = Explosion.Origin;
+			// falloff is already in DamageAmount, full inner radius keeps InternalTakeRadialDamage from scaling it again
+			DamageEvent.Params = FRadialDamageParams(DamageAmount, Explosion.Radius, Explosion.Radius, 0.0f);
+
+			FHitResult& Hit = DamageEvent.ComponentHits.AddDefaulted_GetRef();
+			Hit.Actor = Actor;
+			Hit.Component = Target.Component;
+			Hit.bBlockingHit = true;
+			Hit.TraceStart = Explosion.Origin;
+			Hit.TraceEnd = Target.Location;
+			Hit.Location = Hit.ImpactPoint = Target.Location;
+			Hit.Normal = Hit.ImpactNormal = (Explosion.Origin - Target.Location).GetSafeNormal();
+
+			Actor->TakeDamage(DamageAmount, DamageEvent, Explosion.EventInstigator.Get(), Explosion.DamageCauser.Get());
+		}
+	}
+}
+
+double FShooterRadialDamageService::MeasureExplosion(const FShooterRadialDamageParams& Params, int32 Iterations, int32& OutNumCandidates, int32& OutNumVisible)
+{
+	Iterations = FMath::Max(Iterations, 1);
+	OutNumCandidates = 0;
+	OutNumVisible = 0;
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		FBatch Batch;
+		Batch.Origin = Params.Origin;
+		Batch.Radius = Params.Radius;
+		Batch.OcclusionChannel = Params.OcclusionChannel;
+		Batch.Explosions.Add(Params);
+
+		StartBatch(Batch, false);
+
+		OutNumCandidates = Batch.Targets.Num();
+		OutNumVisible = 0;
+		for (const FTarget& Target : Batch.Targets)
+		{
+			if (Target.bVisible && GetDamageAtDistance(Params, FVector::Dist(Params.Origin, Target.Location)) > 0.0f)
+			{
+				OutNumVisible++;
+			}
+		}
+	}
+
+	return (FPlatformTime::Seconds() - StartTime) * 1000.0 / Iterations;
+}
@@ -9,6 +9,33 @@
 #include "UI/ShooterHUD.h"
 #include "Camera/CameraShake.h"
 
+DECLARE_CYCLE_STAT(TEXT("Weapon Fire"), STAT_ShooterWeaponFire, STATGROUP_ShooterGame);
+DECLARE_CYCLE_STAT(TEXT("Weapon Simulate Fire"), STAT_ShooterWeaponSimulateFire, STATGROUP_ShooterGame);
+
+static int32 ShooterWeaponFireLOD = 1;
+FAutoConsoleVariableRef CVarShooterWeaponFireLOD(
+	TEXT("ShooterWeapon.FireLOD"),
+	ShooterWeaponFireLOD,
+	TEXT("Reduce cosmetic effects of distant or hidden remote shooters.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Default);
+
+static float ShooterWeaponFireLODFullDistance = 2500.0f;
+FAutoConsoleVariableRef CVarShooterWeaponFireLODFullDistance(
+	TEXT("ShooterWeapon.FireLODFullDistance"),
+	ShooterWeaponFireLODFullDistance,
+	TEXT("Visible remote shooters closer than this get full fire effects."),
+	ECVF_Default);
+
+static float ShooterWeaponFireLODMinimalDistance = 6000.0f;
+FAutoConsoleVariableRef CVarShooterWeaponFireLODMinimalDistance(
+	TEXT("ShooterWeapon.FireLODMinimalDistance"),
+	ShooterWeaponFireLODMinimalDistance,
+	TEXT("Remote shooters further than this only play fire sounds."),
+	ECVF_Default);
+
+int32 AShooterWeapon::FireLODCounters[EWeaponFireLOD::MAX] = { 0 };
+
 AShooterWeapon::AShooterWeapon(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	Mesh1P = ObjectInitializer.CreateDefaultSubobject<USkeletalMeshComponent>(this, TEXT("WeaponMesh1P"));
@@ -55,6 +82,8 @@ AShooterWeapon::AShooterWeapon(const FObjectInitializer& ObjectInitializer) : Su
 
 void AShooterWeapon::PostInitializeComponents()
 {
+	SHOOTER_LLM_SCOPE(Weapons);
+
 	Super::PostInitializeComponents();
 
 	if (WeaponConfig.InitialClips > 0)
@@ -144,6 +173,7 @@ void AShooterWeapon::OnUnEquip()
 	{
 		StopWeaponAnimation(ReloadAnim);
 		bPendingReload = false;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterWeapon, bPendingReload, this);
 
 		GetWorldTimerManager().ClearTimer(TimerHandle_StopReload);
 		GetWorldTimerManager().ClearTimer(TimerHandle_ReloadWeapon);
@@ -259,6 +289,7 @@ void AShooterWeapon::StartReload(bool bFromReplication)
 	if (bFromReplication || CanReload())
 	{
 		bPendingReload = true;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterWeapon, bPendingReload, this);
 		DetermineWeaponState();
 
 		float AnimDuration = PlayWeaponAnimation(ReloadAnim);		
@@ -285,6 +316,7 @@ void AShooterWeapon::StopReload()
 	if (CurrentState == EWeaponState::Reloading)
 	{
 		bPendingReload = false;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterWeapon, bPendingReload, this);
 		DetermineWeaponState();
 		StopWeaponAnimation(ReloadAnim);
 	}
@@ -362,6 +394,7 @@ void AShooterWeapon::GiveAmmo(int AddAmount)
 	const int32 MissingAmmo = FMath::Max(0, WeaponConfig.MaxAmmo - CurrentAmmo);
 	AddAmount = FMath::Min(AddAmount, MissingAmmo);
 	CurrentAmmo += AddAmount;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterWeapon, CurrentAmmo, this);
 
 	AShooterAIController* BotAI = MyPawn ? Cast<AShooterAIController>(MyPawn->GetController()) : NULL;
 	if (BotAI)
@@ -383,11 +416,27 @@ void AShooterWeapon::UseAmmo()
 	if (!HasInfiniteAmmo())
 	{
 		CurrentAmmoInClip--;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterWeapon, CurrentAmmoInClip, this);
 	}
 
 	if (!HasInfiniteAmmo() && !HasInfiniteClip())
 	{
 		CurrentAmmo--;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterWeapon, CurrentAmmo, this);
+	}
+
+	// let the game mode know where the fight is
+	AShooterGameMode* GameMode = GetWorld()->GetAuthGameMode<AShooterGameMode>();
+	if (GameMode)
+	{
+		GameMode->GetTeamInfluenceMap().NotifyWeaponFired(MyPawn);
+	}
+
+	FShooterCombatRecorder* CombatRecorder = FShooterCombatRecorder::Get(this);
+	if (CombatRecorder && MyPawn)
+	{
+		CombatRecorder->Record(EShooterCombatEvent::Shot, FShooterCombatRecorder::GetInstigatorFlags(MyPawn->GetController()), (uint16)GetAmmoType(),
+			FShooterCombatRecorder::GetPlayerId(MyPawn), INDEX_NONE, 0.0f, MyPawn->GetActorLocation());
 	}
 
 	AShooterAIController* BotAI = MyPawn ? Cast<AShooterAIController>(MyPawn->GetController()) : NULL;	
@@ -429,6 +478,8 @@ void AShooterWeapon::HandleReFiring()
 
 void AShooterWeapon::HandleFiring()
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterWeaponFire, ShooterWeapons, Fire);
+
 	if ((CurrentAmmoInClip > 0 || HasInfiniteClip() || HasInfiniteAmmo()) && CanFire())
 	{
 		if (GetNetMode() != NM_DedicatedServer)
@@ -444,6 +495,7 @@ void AShooterWeapon::HandleFiring()
 			
 			// update firing FX on remote clients if function was called on server
 			BurstCounter++;
+			MARK_PROPERTY_DIRTY_FROM_NAME(AShooterWeapon, BurstCounter, this);
 		}
 	}
 	else if (CanReload())
@@ -518,6 +570,7 @@ void AShooterWeapon::ServerHandleFiring_Implementation()
 
 		// update firing FX on remote clients
 		BurstCounter++;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterWeapon, BurstCounter, this);
 	}
 }
 
@@ -533,11 +586,13 @@ void AShooterWeapon::ReloadWeapon()
 	if (ClipDelta > 0)
 	{
 		CurrentAmmoInClip += ClipDelta;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterWeapon, CurrentAmmoInClip, this);
 	}
 
 	if (HasInfiniteClip())
 	{
 		CurrentAmmo = FMath::Max(CurrentAmmoInClip, CurrentAmmo);
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterWeapon, CurrentAmmo, this);
 	}
 }
 
@@ -607,6 +662,7 @@ void AShooterWeapon::OnBurstFinished()
 {
 	// stop firing FX on remote clients
 	BurstCounter = 0;
+	MARK_PROPERTY_DIRTY_FROM_NAME(AShooterWeapon, BurstCounter, this);
 
 	// stop firing FX locally, unless it's a dedicated server
 	//if (GetNetMode() != NM_DedicatedServer)
@@ -625,12 +681,12 @@ void AShooterWeapon::OnBurstFinished()
 //////////////////////////////////////////////////////////////////////////
 // Weapon usage helpers
 
-UAudioComponent* AShooterWeapon::PlayWeaponSound(USoundCue* Sound)
+UAudioComponent* AShooterWeapon::PlayWeaponSound(USoundCue* Sound, bool bRetain)
 {
 	UAudioComponent* AC = NULL;
 	if (Sound && MyPawn)
 	{
-		AC = UGameplayStatics::SpawnSoundAttached(Sound, MyPawn->GetRootComponent());
+		AC = FShooterAudioManager::SpawnSoundAttached(EShooterSoundCategory::Weapon, Sound, MyPawn->GetRootComponent(), bRetain);
 	}
 
 	return AC;
@@ -766,6 +822,7 @@ void AShooterWeapon::SetOwningPawn(AShooterCharacter* NewOwner)
 	{
 		SetInstigator(NewOwner);
 		MyPawn = NewOwner;
+		MARK_PROPERTY_DIRTY_FROM_NAME(AShooterWeapon, MyPawn, this);
 		// net owner for RPC calls
 		SetOwner(NewOwner);
 	}	
@@ -812,12 +869,18 @@ void AShooterWeapon::OnRep_Reload()
 
 void AShooterWeapon::SimulateWeaponFire()
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterWeaponSimulateFire, ShooterEffects, WeaponFire);
+	SHOOTER_LLM_SCOPE(Effects);
+
 	if (GetLocalRole() == ROLE_Authority && CurrentState != EWeaponState::Firing)
 	{
 		return;
 	}
 
-	if (MuzzleFX)
+	const EWeaponFireLOD::Type FireLOD = GetFireLOD();
+	FireLODCounters[FireLOD]++;
+
+	if (MuzzleFX && FireLOD != EWeaponFireLOD::Minimal)
 	{
 		USkeletalMeshComponent* UseWeaponMesh = GetWeaponMesh();
 		if (!bLoopedMuzzleFX || MuzzlePSC == NULL)
@@ -846,7 +909,7 @@ void AShooterWeapon::SimulateWeaponFire()
 		}
 	}
 
-	if (!bLoopedFireAnim || !bPlayingFireAnim)
+	if (FireLOD == EWeaponFireLOD::Full && (!bLoopedFireAnim || !bPlayingFireAnim))
 	{
 		PlayWeaponAnimation(FireAnim);
 		bPlayingFireAnim = true;
@@ -856,13 +919,18 @@ void AShooterWeapon::SimulateWeaponFire()
 	{
 		if (FireAC == NULL)
 		{
-			FireAC = PlayWeaponSound(FireLoopSound);
+			FireAC = PlayWeaponSound(FireLoopSound, true);
 		}
 	}
-	else
+	else if (FireLOD == EWeaponFireLOD::Full)
 	{
 		PlayWeaponSound(FireSound);
 	}
+	else
+	{
+		// distant shots don't follow the pawn
+		FShooterAudioManager::PlaySoundAtLocation(this, EShooterSoundCategory::Weapon, FireSound, GetActorLocation());
+	}
 
 	AShooterPlayerController* PC = (MyPawn != NULL) ? Cast<AShooterPlayerController>(MyPawn->Controller) : NULL;
 	if (PC != NULL && PC->IsLocalController())
@@ -880,6 +948,40 @@ void AShooterWeapon::SimulateWeaponFire()
 	}
 }
 
+EWeaponFireLOD::Type AShooterWeapon::GetFireLOD() const
+{
+	if (ShooterWeaponFireLOD == 0 || MyPawn == NULL || MyPawn->IsLocallyControlled())
+	{
+		return EWeaponFireLOD::Full;
+	}
+
+	float MinDistanceSq = MAX_FLT;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			MinDistanceSq = FMath::Min(MinDistanceSq, FVector::DistSquared(ViewLocation, MyPawn->GetActorLocation()));
+		}
+	}
+
+	if (MinDistanceSq > FMath::Square(ShooterWeaponFireLODMinimalDistance))
+	{
+		return EWeaponFireLOD::Minimal;
+	}
+
+	// not rendered lately means off screen or occluded
+	if (MinDistanceSq > FMath::Square(ShooterWeaponFireLODFullDistance) || !MyPawn->WasRecentlyRendered(0.2f))
+	{
+		return EWeaponFireLOD::Reduced;
+	}
+
+	return EWeaponFireLOD::Full;
+}
+
 void AShooterWeapon::StopSimulatingWeaponFire()
 {
 	if (bLoopedMuzzleFX )
@@ -904,8 +1006,7 @@ void AShooterWeapon::StopSimulatingWeaponFire()
 
 	if (FireAC)
 	{
-		FireAC->FadeOut(0.1f, 0.0f);
-		FireAC = NULL;
+		FShooterAudioManager::StopSound(FireAC, 0.1f);
 
 		PlayWeaponSound(FireFinishSound);
 	}
@@ -915,13 +1016,18 @@ void AShooterWeapon::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & O
 {
 	Super::GetLifetimeReplicatedProps( OutLifetimeProps );
 
-	DOREPLIFETIME( AShooterWeapon, MyPawn );
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST( AShooterWeapon, MyPawn, Params );
 
-	DOREPLIFETIME_CONDITION( AShooterWeapon, CurrentAmmo,		COND_OwnerOnly );
-	DOREPLIFETIME_CONDITION( AShooterWeapon, CurrentAmmoInClip, COND_OwnerOnly );
+	Params.Condition = COND_OwnerOnly;
+	DOREPLIFETIME_WITH_PARAMS_FAST( AShooterWeapon, CurrentAmmo,		Params );
+	DOREPLIFETIME_WITH_PARAMS_FAST( AShooterWeapon, CurrentAmmoInClip,	Params );
 
-	DOREPLIFETIME_CONDITION( AShooterWeapon, BurstCounter,		COND_SkipOwner );
-	DOREPLIFETIME_CONDITION( AShooterWeapon, bPendingReload,	COND_SkipOwner );
+	Params.Condition = COND_SkipOwner;
+	DOREPLIFETIME_WITH_PARAMS_FAST( AShooterWeapon, BurstCounter,		Params );
+	DOREPLIFETIME_WITH_PARAMS_FAST( AShooterWeapon, bPendingReload,		Params );
 }
 
 USkeletalMeshComponent* AShooterWeapon::GetWeaponMesh() const
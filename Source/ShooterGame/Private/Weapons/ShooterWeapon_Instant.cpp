@@ -5,6 +5,12 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "Effects/ShooterImpactEffect.h"
 
+DECLARE_CYCLE_STAT(TEXT("Hit Validation"), STAT_ShooterHitValidation, STATGROUP_ShooterGame);
+DECLARE_CYCLE_STAT(TEXT("Miss Validation"), STAT_ShooterMissValidation, STATGROUP_ShooterGame);
+DECLARE_CYCLE_STAT(TEXT("Instant Hit"), STAT_ShooterProcessInstantHit, STATGROUP_ShooterGame);
+DECLARE_CYCLE_STAT(TEXT("Weapon Impact Effects"), STAT_ShooterWeaponImpactEffects, STATGROUP_ShooterGame);
+DECLARE_CYCLE_STAT(TEXT("Weapon Trail Effects"), STAT_ShooterWeaponTrailEffects, STATGROUP_ShooterGame);
+
 AShooterWeapon_Instant::AShooterWeapon_Instant(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	CurrentFiringSpread = 0.0f;
@@ -38,6 +44,8 @@ bool AShooterWeapon_Instant::ServerNotifyHit_Validate(const FHitResult& Impact,
 
 void AShooterWeapon_Instant::ServerNotifyHit_Implementation(const FHitResult& Impact, FVector_NetQuantizeNormal ShootDir, int32 RandomSeed, float ReticleSpread)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterHitValidation, ShooterWeapons, HitValidation);
+
 	const float WeaponAngleDot = FMath::Abs(FMath::Sin(ReticleSpread * PI / 180.f));
 
 	// if we have an instigator, calculate dot between the view and the shot
@@ -114,6 +122,8 @@ bool AShooterWeapon_Instant::ServerNotifyMiss_Validate(FVector_NetQuantizeNormal
 
 void AShooterWeapon_Instant::ServerNotifyMiss_Implementation(FVector_NetQuantizeNormal ShootDir, int32 RandomSeed, float ReticleSpread)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterMissValidation, ShooterWeapons, MissValidation);
+
 	const FVector Origin = GetMuzzleLocation();
 
 	// play FX on remote clients
@@ -131,6 +141,8 @@ void AShooterWeapon_Instant::ServerNotifyMiss_Implementation(FVector_NetQuantize
 
 void AShooterWeapon_Instant::ProcessInstantHit(const FHitResult& Impact, const FVector& Origin, const FVector& ShootDir, int32 RandomSeed, float ReticleSpread)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterProcessInstantHit, ShooterWeapons, ProcessHit);
+
 	if (MyPawn && MyPawn->IsLocallyControlled() && GetNetMode() == NM_Client)
 	{
 		// if we're a client and we've hit something that is being controlled by the server
@@ -257,18 +269,30 @@ void AShooterWeapon_Instant::SimulateInstantHit(const FVector& ShotOrigin, int32
 	if (Impact.bBlockingHit)
 	{
 		SpawnImpactEffects(Impact);
-		SpawnTrailEffect(Impact.ImpactPoint);
 	}
-	else
+
+	// trails only for nearby visible shooters, impacts have their own budget
+	if (GetFireLOD() == EWeaponFireLOD::Full)
 	{
-		SpawnTrailEffect(EndTrace);
+		SpawnTrailEffect(Impact.bBlockingHit ? Impact.ImpactPoint : EndTrace);
 	}
 }
 
 void AShooterWeapon_Instant::SpawnImpactEffects(const FHitResult& Impact)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterWeaponImpactEffects, ShooterEffects, WeaponImpact);
+	SHOOTER_LLM_SCOPE(Effects);
+
 	if (ImpactTemplate && Impact.bBlockingHit)
 	{
+		// played within frame budgets, surface is resolved only for impacts which get effects
+		FShooterImpactEffectManager* EffectManager = FShooterImpactEffectManager::Get(this);
+		if (EffectManager)
+		{
+			EffectManager->AddImpact(ImpactTemplate, Impact);
+			return;
+		}
+
 		FHitResult UseImpact = Impact;
 
 		// trace again to find component lost during replication
@@ -292,6 +316,9 @@ void AShooterWeapon_Instant::SpawnImpactEffects(const FHitResult& Impact)
 
 void AShooterWeapon_Instant::SpawnTrailEffect(const FVector& EndPoint)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(STAT_ShooterWeaponTrailEffects, ShooterEffects, WeaponTrail);
+	SHOOTER_LLM_SCOPE(Effects);
+
 	if (TrailFX)
 	{
 		const FVector Origin = GetMuzzleLocation();
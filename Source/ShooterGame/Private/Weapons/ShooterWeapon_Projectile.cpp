@@ -6,6 +6,7 @@
 
 AShooterWeapon_Projectile::AShooterWeapon_Projectile(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
+	LastShotId = 0;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -61,26 +62,104 @@ void AShooterWeapon_Projectile::FireWeapon()
 		}
 	}
 
-	ServerFireProjectile(Origin, ShootDir);
+	uint8 ShotId = 0;
+	if (GetLocalRole() < ROLE_Authority)
+	{
+		// show rocket right away, replicated one takes over when it arrives
+		ShotId = ++LastShotId;
+		if (ShotId == 0)
+		{
+			ShotId = ++LastShotId;
+		}
+
+		AShooterProjectile* Projectile = SpawnProjectile(Origin, ShootDir, ShotId, true);
+		if (Projectile)
+		{
+			PredictedProjectiles.Add(Projectile);
+		}
+	}
+
+	ServerFireProjectile(Origin, ShootDir, ShotId);
 }
 
-bool AShooterWeapon_Projectile::ServerFireProjectile_Validate(FVector Origin, FVector_NetQuantizeNormal ShootDir)
+bool AShooterWeapon_Projectile::ServerFireProjectile_Validate(FVector Origin, FVector_NetQuantizeNormal ShootDir, uint8 ShotId)
 {
 	return true;
 }
 
-void AShooterWeapon_Projectile::ServerFireProjectile_Implementation(FVector Origin, FVector_NetQuantizeNormal ShootDir)
+void AShooterWeapon_Projectile::ServerFireProjectile_Implementation(FVector Origin, FVector_NetQuantizeNormal ShootDir, uint8 ShotId)
+{
+	AShooterProjectile* Projectile = SpawnProjectile(Origin, ShootDir, ShotId, false);
+	if (Projectile == NULL && ShotId != 0)
+	{
+		ClientRejectProjectile(ShotId);
+	}
+}
+
+void AShooterWeapon_Projectile::ClientRejectProjectile_Implementation(uint8 ShotId)
+{
+	AShooterProjectile* Projectile = TakePredictedProjectile(ShotId);
+	if (Projectile)
+	{
+		Projectile->Destroy();
+	}
+}
+
+AShooterProjectile* AShooterWeapon_Projectile::SpawnProjectile(const FVector& Origin, const FVector& ShootDir, uint8 ShotId, bool bPredicted)
 {
 	FTransform SpawnTM(ShootDir.Rotation(), Origin);
+	FVector Direction = ShootDir;
+
+	FShooterProjectilePool* Pool = bPredicted ? NULL : FShooterProjectilePool::Get(this);
+	if (Pool)
+	{
+		return Pool->SpawnActor<AShooterProjectile>(ProjectileConfig.ProjectileClass, SpawnTM, this, GetInstigator(), [&](AShooterProjectile* Projectile)
+		{
+			Projectile->InitVelocity(Direction);
+			Projectile->SetShotId(ShotId, false);
+		});
+	}
+
 	AShooterProjectile* Projectile = Cast<AShooterProjectile>(UGameplayStatics::BeginDeferredActorSpawnFromClass(this, ProjectileConfig.ProjectileClass, SpawnTM));
 	if (Projectile)
 	{
 		Projectile->SetInstigator(GetInstigator());
 		Projectile->SetOwner(this);
-		Projectile->InitVelocity(ShootDir);
+		Projectile->InitVelocity(Direction);
+		Projectile->SetShotId(ShotId, bPredicted);
 
 		UGameplayStatics::FinishSpawningActor(Projectile, SpawnTM);
 	}
+
+	return Projectile;
+}
+
+AShooterProjectile* AShooterWeapon_Projectile::TakePredictedProjectile(uint8 ShotId)
+{
+	AShooterProjectile* Result = NULL;
+
+	for (int32 Idx = PredictedProjectiles.Num() - 1; Idx >= 0; Idx--)
+	{
+		AShooterProjectile* Projectile = PredictedProjectiles[Idx].Get();
+		if (Projectile == NULL || Projectile->GetShotId() == ShotId)
+		{
+			Result = Projectile ? Projectile : Result;
+			PredictedProjectiles.RemoveAtSwap(Idx);
+		}
+	}
+
+	return Result;
+}
+
+void AShooterWeapon_Projectile::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	FShooterProjectilePool* Pool = FShooterProjectilePool::Get(this);
+	if (Pool)
+	{
+		Pool->Prewarm(ProjectileConfig.ProjectileClass);
+	}
 }
 
 void AShooterWeapon_Projectile::ApplyWeaponConfig(FProjectileWeaponData& Data)
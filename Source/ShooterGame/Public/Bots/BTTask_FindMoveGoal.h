@@ -0,0 +1,22 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+#include "BehaviorTree/Tasks/BTTask_BlackboardBase.h"
+#include "BTTask_FindMoveGoal.generated.h"
+
+// Base for bot AI tasks picking a move goal. Path to the goal is resolved on the bot path queue
+// before the blackboard key is set, so the following move doesn't do synchronous path finding
+UCLASS(Abstract)
+class UBTTask_FindMoveGoal : public UBTTask_BlackboardBase
+{
+	GENERATED_UCLASS_BODY()
+
+	virtual EBTNodeResult::Type AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+protected:
+	/** sets blackboard key to Goal, once path to it is found */
+	EBTNodeResult::Type SetMoveGoal(UBehaviorTreeComponent& OwnerComp, const FVector& Goal);
+
+	/** bot path queue callback */
+	void OnMoveGoalPathReady(bool bPathFound, TWeakObjectPtr<UBehaviorTreeComponent> OwnerComp, FVector Goal);
+};
@@ -1,12 +1,12 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #pragma once
-#include "BehaviorTree/Tasks/BTTask_BlackboardBase.h"
+#include "Bots/BTTask_FindMoveGoal.h"
 #include "BTTask_FindPickup.generated.h"
 
 // Bot AI Task that attempts to locate a pickup 
 UCLASS()
-class UBTTask_FindPickup : public UBTTask_BlackboardBase
+class UBTTask_FindPickup : public UBTTask_FindMoveGoal
 {
 	GENERATED_UCLASS_BODY()
 		
@@ -2,12 +2,12 @@
 
 #pragma once
 #include "BehaviorTree/BTNode.h"
-#include "BehaviorTree/Tasks/BTTask_BlackboardBase.h"
+#include "Bots/BTTask_FindMoveGoal.h"
 #include "BTTask_FindPointNearEnemy.generated.h"
 
 // Bot AI task that tries to find a location near the current enemy
 UCLASS()
-class UBTTask_FindPointNearEnemy : public UBTTask_BlackboardBase
+class UBTTask_FindPointNearEnemy : public UBTTask_FindMoveGoal
 {
 	GENERATED_UCLASS_BODY()
 
@@ -49,14 +49,27 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = Behavior)
 	bool FindClosestEnemyWithLOS(AShooterCharacter* ExcludeEnemy);
+
+	/* Finds navigable location within SearchRadius using team influence map: away from enemies, or to contested area held by own team */
+	UFUNCTION(BlueprintCallable, Category = Behavior)
+	bool FindInfluenceLocation(bool bAdvance, float SearchRadius, FVector& OutLocation) const;
 		
 	bool HasWeaponLOSToEnemy(AActor* InEnemyActor, const bool bAnyEnemy) const;
 
 	// Begin AAIController interface
 	/** Update direction AI is looking based on FocalPoint */
 	virtual void UpdateControlRotation(float DeltaTime, bool bUpdatePawn = true) override;
+
+	/** uses path computed by async bot path queue when it matches the goal */
+	virtual FPathFollowingRequestResult MoveTo(const FAIMoveRequest& MoveRequest, FNavPathSharedPtr* OutPath = nullptr) override;
 	// End AAIController interface
 
+	/** store path computed asynchronously, used by next move to Goal */
+	void SetPrecomputedPath(const FVector& Goal, FNavPathSharedPtr Path);
+
+	/** sets behavior tree think interval for think rate at current server tick rate */
+	void UpdateThinkInterval();
+
 protected:
 	// Check of we have LOS to a character
 	bool LOSTrace(AShooterCharacter* InEnemyChar) const;
@@ -67,6 +80,12 @@ protected:
 	/** Handle for efficient management of Respawn timer */
 	FTimerHandle TimerHandle_Respawn;
 
+	/** path from async bot path queue, waiting for move request */
+	FNavPathSharedPtr PrecomputedPath;
+
+	/** goal of PrecomputedPath */
+	FVector PrecomputedPathGoal;
+
 public:
 	/** Returns BlackboardComp subobject **/
 	FORCEINLINE UBlackboardComponent* GetBlackboardComp() const { return BlackboardComp; }
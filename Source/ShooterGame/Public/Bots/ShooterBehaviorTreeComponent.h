@@ -0,0 +1,28 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "ShooterBehaviorTreeComponent.generated.h"
+
+/**
+ * Behavior tree component of bots, runs the tree at most once per think interval.
+ * Tree schedules its own tick interval after every tick, so frames are skipped in tick instead.
+ */
+UCLASS()
+class UShooterBehaviorTreeComponent : public UBehaviorTreeComponent
+{
+	GENERATED_UCLASS_BODY()
+
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/** sets min time between two runs of the tree (s), 0 runs it whenever it asks to */
+	void SetThinkInterval(float InThinkInterval);
+
+protected:
+
+	/** min time between two runs of the tree (s) */
+	float ThinkInterval;
+
+	/** time of ticks skipped since last run (s) */
+	float SkippedDeltaTime;
+};
@@ -16,4 +16,13 @@ class AShooterBot : public AShooterCharacter
 	virtual bool IsFirstPerson() const override;
 
 	virtual void FaceRotation(FRotator NewRotation, float DeltaTime = 0.f) override;
+
+	virtual void BeginPlay() override;
+
+protected:
+	/** switch movement LOD depending on distance to players */
+	void UpdateMovementLOD();
+
+	/** Handle for efficient management of UpdateMovementLOD timer */
+	FTimerHandle TimerHandle_MovementLOD;
 };
\ No newline at end of file
@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "AI/Navigation/NavigationTypes.h"
+
+class AShooterAIController;
+
+DECLARE_DELEGATE_OneParam(FOnShooterBotPathReady, bool /*bPathFound*/);
+
+/**
+ * Queue of bot path requests, resolved asynchronously on the navigation system's worker tasks.
+ * Only a limited number of requests is dispatched per frame, oldest first, and every bot
+ * may have at most one request queued or in flight - a newer request replaces the older one.
+ * Owned and ticked by the game mode.
+ */
+class FShooterBotPathQueue
+{
+public:
+
+	~FShooterBotPathQueue();
+
+	/** sets world used for navigation queries */
+	void Initialize(UWorld* InWorld);
+
+	/** queue path request for bot, OnReady is called on game thread when the path was stored in the controller */
+	void RequestPath(AShooterAIController* Bot, const FVector& Goal, const FOnShooterBotPathReady& OnReady);
+
+	/** drops queued or in flight request for bot, its delegate will not be called */
+	void CancelRequest(AShooterAIController* Bot);
+
+	/** dispatches queued requests, within per frame budget */
+	void Tick();
+
+	/** cancels everything */
+	void Reset();
+
+	/** is async path finding enabled? */
+	static bool IsEnabled();
+
+	/** number of requests waiting for dispatch */
+	int32 GetNumQueued() const { return QueuedRequests.Num(); }
+
+	/** number of requests processed by navigation system */
+	int32 GetNumInFlight() const { return InFlightRequests.Num(); }
+
+private:
+
+	struct FBotPathRequest
+	{
+		TWeakObjectPtr<AShooterAIController> Bot;
+		FVector Goal;
+		FOnShooterBotPathReady OnReady;
+	};
+
+	/** navigation system callback */
+	void OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+
+	/** world used for queries */
+	TWeakObjectPtr<UWorld> World;
+
+	/** requests waiting for dispatch, in submission order */
+	TArray<FBotPathRequest> QueuedRequests;
+
+	/** requests dispatched to navigation system, by query id */
+	TMap<uint32, FBotPathRequest> InFlightRequests;
+};
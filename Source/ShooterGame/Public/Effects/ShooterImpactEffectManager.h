@@ -0,0 +1,79 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/GCObject.h"
+
+class AShooterImpactEffect;
+class UDecalComponent;
+class UParticleSystemComponent;
+
+/**
+ * Plays weapon impact effects without spawning an actor per hit. Impacts are gathered during the frame and
+ * resolved in tick: nearest to local viewers first, each one getting particles, sound and decal only while it's
+ * within cull distance of that feature and per frame and concurrent budgets allow, sounds go through the audio manager. Decals come from a fixed ring,
+ * the manager fades and hides them itself so ring components are never destroyed behind its back.
+ * Owned by the game state, does nothing on dedicated servers.
+ */
+class FShooterImpactEffectManager : public FGCObject
+{
+public:
+
+	FShooterImpactEffectManager();
+
+	// Begin FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FShooterImpactEffectManager"); }
+	// End FGCObject interface
+
+	/** sets world to play effects in */
+	void Initialize(UWorld* InWorld);
+
+	/** get manager of world */
+	static FShooterImpactEffectManager* Get(const UObject* WorldContextObject);
+
+	/** queue impact, effects are taken from template's defaults */
+	void AddImpact(TSubclassOf<AShooterImpactEffect> Template, const FHitResult& Impact);
+
+	/** plays queued impacts within budgets */
+	void Tick();
+
+private:
+
+	struct FImpactRequest
+	{
+		TSubclassOf<AShooterImpactEffect> Template;
+
+		FHitResult Impact;
+
+		/** squared distance to closest local viewer */
+		float DistanceSq;
+	};
+
+	/** find component and physical material lost during replication */
+	FHitResult ResolveSurface(const FHitResult& Impact) const;
+
+	/** place decal from ring */
+	void PlaceDecal(const AShooterImpactEffect* Effect, const FHitResult& Impact);
+
+	/** hide decals which faded out */
+	void HideExpiredDecals();
+
+	/** world to play effects in */
+	TWeakObjectPtr<UWorld> World;
+
+	/** impacts of this frame */
+	TArray<FImpactRequest> PendingImpacts;
+
+	/** emitters which may still be playing */
+	TArray<TWeakObjectPtr<UParticleSystemComponent>> ActiveParticles;
+
+	/** recycled decals, not owned by any actor */
+	TArray<UDecalComponent*> DecalRing;
+
+	/** world time each decal of ring is hidden at, 0 when it stays */
+	TArray<float> DecalHideTimes;
+
+	/** next decal in ring to use */
+	int32 NextDecal;
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "GameFramework/Actor.h"
+#include "Weapons/ShooterProjectilePool.h"
 
 #include "ShooterGameGrenade.generated.h"
 
@@ -39,8 +40,48 @@ public:
     }
 };
 
+/**
+ * Launch parameters of the grenade, sent once so clients can simulate the
+ * trajectory themselves instead of receiving physics state every frame
+ */
+USTRUCT()
+struct FShooterGameGrenadeLaunchInfo
+{
+    GENERATED_BODY()
+
+public:
+    /** Location the grenade was thrown from */
+    UPROPERTY()
+    FVector_NetQuantize Origin;
+
+    /** Direction of the launch impulse */
+    UPROPERTY()
+    FVector_NetQuantizeNormal Direction;
+
+    /** Strength of the launch impulse */
+    UPROPERTY()
+    float Strength;
+
+    /** Server world time of the throw */
+    UPROPERTY()
+    float LaunchTime;
+
+    /** Id used by the throwing client to match its predicted grenade */
+    UPROPERTY()
+    uint8 ThrowId;
+
+    FShooterGameGrenadeLaunchInfo()
+    {
+        Origin = FVector::ZeroVector;
+        Direction = FVector::ForwardVector;
+        Strength = 0.0f;
+        LaunchTime = 0.0f;
+        ThrowId = 0;
+    }
+};
+
 UCLASS()
-class AShooterGameGrenade : public AActor
+class AShooterGameGrenade : public AActor, public IShooterPoolableActor
 {
     GENERATED_BODY()
 
@@ -50,12 +91,20 @@ public:
 #if 1 // Actor Interface
 protected:
     virtual void BeginPlay() override;
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+    virtual void LifeSpanExpired() override;
 
 #if WITH_EDITOR
     virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif WITH_EDITOR
 #endif // Actor Interface
 
+#if 1 // Poolable Actor Interface
+public:
+    virtual void OnAcquiredFromPool() override;
+    virtual void OnReleasedToPool() override;
+#endif // Poolable Actor Interface
+
 #if 1 // Shooter Game Grenade
 private:
     /** Mesh component for rendering the grenade */
@@ -63,7 +112,7 @@ private:
     class UStaticMeshComponent* GrenadeStaticMeshComponent;
 
     /** 
-     * Collision component for handling damage against other actors 
+     * Sphere visualizing the explosion radius in debug mode 
      * Radius is affected by DamageCurve where the max X-Value is the Radius
      */
     UPROPERTY()
@@ -112,6 +161,77 @@ private:
     void UpdateExplosionRadiusSphereComponent();
 #endif // Gameplay
 
+#if 1 // Networking
+public:
+    /**
+     * Sets up the launch, must be called before the grenade finishes spawning
+     * @param bInPredicted True for the local copy spawned by the throwing client
+     */
+    void InitLaunch(const FVector& Origin, const FVector& Direction, float Strength, float LaunchTime, uint8 ThrowId, bool bInPredicted);
+
+    /** @return Id of the throw that spawned this grenade */
+    uint8 GetThrowId() const;
+
+private:
+    /** Launch parameters, only change when the grenade is thrown or reused from the pool */
+    UPROPERTY(ReplicatedUsing = OnRep_LaunchInfo)
+    FShooterGameGrenadeLaunchInfo LaunchInfo;
+
+    /** Set by the server when the grenade detonates */
+    UPROPERTY(Transient, ReplicatedUsing = OnRep_Detonated)
+    bool bDetonated;
+
+    /** Authoritative location of the detonation */
+    UPROPERTY(Transient, Replicated)
+    FVector_NetQuantize DetonationLocation;
+
+    /** Max seconds of the thrower's latency taken off the server fuse */
+    UPROPERTY(Category = "Grenade|Network", EditAnywhere)
+    float MaxFuseCompensation;
+
+    /** Seconds after the fuse a predicted grenade waits for the server before it is removed */
+    UPROPERTY(Category = "Grenade|Network", EditAnywhere)
+    float PredictionTimeout;
+
+    /** True for the local copy spawned by the throwing client */
+    bool bPredicted;
+
+    /** On the throwing client: the predicted grenade this replicated grenade stands for */
+    TWeakObjectPtr<AShooterGameGrenade> PredictedGrenade;
+
+private:
+    UFUNCTION()
+    void OnRep_LaunchInfo();
+
+    UFUNCTION()
+    void OnRep_Detonated();
+
+    /** [server] Starts the fuse and launches the grenade */
+    void StartAuthorityLaunch();
+
+    /** [client] Launches the grenade from the launch info, unless a predicted copy represents it */
+    void StartClientLaunch();
+
+    /** Moves the grenade to the launch origin and applies the launch impulse */
+    void Launch();
+
+    /** On the throwing client, hides this grenade when a predicted copy already represents it */
+    void LinkPredictedGrenade();
+
+    /** Predicted grenade was never confirmed by the server */
+    UFUNCTION()
+    void OnPredictionTimeout();
+
+    /** Stops simulating and rendering, used once the grenade has detonated */
+    void DisableGrenade();
+
+    /** Undoes DisableGrenade for a grenade reused from the pool */
+    void EnableGrenade();
+
+    /** @return Current world time of the server, as estimated locally */
+    float GetServerWorldTime() const;
+#endif // Networking
+
 #if 1 // VFX/SFX
 private:
     /** VFX to use when the grenade explodes */
@@ -125,6 +245,9 @@ private:
     /** SFX and its settings to use when the grenade explodes */
     UPROPERTY(Category = "Grenade|SFX", EditAnywhere)
     FShooterGameGrenadeSoundSettings ExplosionSoundSettings;
+private:
+    /** Plays one-shot explosion VFX/SFX at the location */
+    void PlayDetonationEffects(const FVector& Location);
 #endif // SFX
 
 #if 1 // Debuggger
@@ -0,0 +1,98 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ShooterTypes.h"
+
+class AShooterPlayerController;
+
+/**
+ * Server side chat. Messages are trimmed to max length and rate limited per sender, then queued and sent by the
+ * game mode tick: each recipient gets one RPC with all messages of the frame it may see. Sender names are interned
+ * per recipient, name is sent once and later messages refer to it by index. Owned by the game mode, server only.
+ */
+class FShooterChatService
+{
+public:
+
+	FShooterChatService();
+
+	/** sets world of recipients */
+	void Initialize(UWorld* InWorld);
+
+	/** get chat service of world, NULL on clients */
+	static FShooterChatService* Get(const UObject* WorldContextObject);
+
+	/** queues message, returns false when it was rejected */
+	bool Say(AShooterPlayerController* Sender, const FString& Msg, EShooterChatChannel::Type Channel);
+
+	/** sends queued messages */
+	void Tick();
+
+	/** messages sent and rejected since last reset */
+	int32 NumSent;
+	int32 NumRateLimited;
+	int32 NumTruncated;
+
+	/** RPCs and names sent since last reset */
+	int32 NumBatches;
+	int32 NumNamesSent;
+
+	/** clears counters */
+	void ResetStats();
+
+private:
+
+	struct FMessage
+	{
+		TWeakObjectPtr<AShooterPlayerController> Sender;
+
+		/** name of sender at the time of sending */
+		FString SenderName;
+
+		/** team of sender, INDEX_NONE in games without teams */
+		int32 TeamNum;
+
+		EShooterChatChannel::Type Channel;
+
+		FString Text;
+	};
+
+	/** rate limit of single sender, token bucket */
+	struct FSenderState
+	{
+		/** messages sender may send right now */
+		float Tokens;
+
+		/** world time of last refill */
+		float LastRefillTime;
+	};
+
+	/** names known to single recipient */
+	struct FRecipientState
+	{
+		/** name to index in recipient's name table */
+		TMap<FString, int32> NameIndices;
+	};
+
+	/** get index of name in recipient's table, adds it to batch when recipient doesn't know it yet. Table starts over when it's full */
+	int32 InternName(FRecipientState& Recipient, FShooterChatBatch& Batch, const FString& Name);
+
+	/** check if interning name would start recipient's table over */
+	bool WouldResetNames(const FRecipientState& Recipient, const FString& Name) const;
+
+	/** sends batch to recipient and empties it */
+	void SendBatch(AShooterPlayerController* PC, FShooterChatBatch& Batch);
+
+	/** world of recipients */
+	TWeakObjectPtr<UWorld> World;
+
+	/** messages of current frame */
+	TArray<FMessage> PendingMessages;
+
+	/** rate limits by PlayerId */
+	TMap<int32, FSenderState> Senders;
+
+	/** interned names by recipient */
+	TMap<TWeakObjectPtr<AShooterPlayerController>, FRecipientState> Recipients;
+};
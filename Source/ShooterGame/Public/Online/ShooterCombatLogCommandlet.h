@@ -0,0 +1,20 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "ShooterCombatLogCommandlet.generated.h"
+
+/**
+ * Reads combat log written by FShooterCombatRecorder and prints per player summary.
+ * Usage: -run=ShooterCombatLog -File=<path to .sclog> [-Dump] to also print every event.
+ */
+UCLASS()
+class UShooterCombatLogCommandlet : public UCommandlet
+{
+	GENERATED_UCLASS_BODY()
+
+	// Begin UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	// End UCommandlet interface
+};
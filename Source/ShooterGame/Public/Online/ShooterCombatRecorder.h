@@ -0,0 +1,261 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "HAL/Runnable.h"
+#include "Templates/Atomic.h"
+
+class FRunnableThread;
+class IFileHandle;
+
+/** types of recorded combat events, stored in logs: only append */
+namespace EShooterCombatEvent
+{
+	enum Type
+	{
+		/** weapon used ammo, Param is EAmmoType */
+		Shot,
+		/** pawn took damage */
+		Hit,
+		/** pawn was killed */
+		Kill,
+		/** pawn got pickup, Param is EShooterCombatPickup */
+		Pickup,
+		MAX,
+	};
+}
+
+/** flags of recorded combat events, stored in logs: only append */
+namespace EShooterCombatEventFlags
+{
+	enum Type
+	{
+		/** instigator is a bot */
+		Bot = 1 << 0,
+		/** damage came from explosion */
+		Radial = 1 << 1,
+		/** hit killed target */
+		Lethal = 1 << 2,
+	};
+}
+
+/** types of recorded pickups, stored in logs: only append */
+namespace EShooterCombatPickup
+{
+	enum Type
+	{
+		Health,
+		Ammo,
+	};
+}
+
+/** single combat event, written to log as is. Layout is part of log format, bump log version when changing it. */
+struct FShooterCombatRecord
+{
+	/** time since start of recording (s) */
+	float Time;
+
+	/** EShooterCombatEvent */
+	uint8 Type;
+
+	/** EShooterCombatEventFlags */
+	uint8 Flags;
+
+	/** event specific type, see EShooterCombatEvent */
+	uint16 Param;
+
+	/** player id of shooter, attacker, killer or player picking up, INDEX_NONE when unknown */
+	int32 InstigatorId;
+
+	/** player id of hit or killed player, INDEX_NONE when none */
+	int32 TargetId;
+
+	/** damage of hits and kills, amount of pickups */
+	float Value;
+
+	/** location of instigator for shots and pickups, of target for hits and kills */
+	float X;
+	float Y;
+	float Z;
+};
+
+static_assert(sizeof(FShooterCombatRecord) == 32, "Combat record size is part of log format");
+
+/** header at start of each combat log */
+struct FShooterCombatLogHeader
+{
+	enum
+	{
+		/** 'SCLG' */
+		LogMagic = 0x474C4353,
+		LogVersion = 1,
+	};
+
+	uint32 Magic;
+	uint16 Version;
+
+	/** sizeof(FShooterCombatRecord) used by writer */
+	uint16 RecordSize;
+
+	/** UTC time of recording start, FDateTime ticks */
+	int64 StartTime;
+
+	/** null terminated */
+	ANSICHAR MapName[48];
+};
+
+static_assert(sizeof(FShooterCombatLogHeader) == 64, "Combat log header size is part of log format");
+
+/**
+ * Records shots, hits, kills and pickups of current match to binary log for balancing and cheat detection.
+ * Events are appended to ring buffer of the calling thread without locks or allocations, flush thread drains
+ * buffers into log file. Events are dropped, not waited for, when buffer is full. Owned by the game mode, server only.
+ */
+class FShooterCombatRecorder : public FRunnable
+{
+public:
+
+	FShooterCombatRecorder();
+	virtual ~FShooterCombatRecorder();
+
+	/** sets world of recorded matches */
+	void Initialize(UWorld* InWorld);
+
+	/** get recorder of world, NULL when it's not recording */
+	static FShooterCombatRecorder* Get(const UObject* WorldContextObject);
+
+	/** opens new log and starts flush thread, ends previous recording */
+	void BeginRecording();
+
+	/** writes all events and closes log */
+	void EndRecording();
+
+	bool IsRecording() const { return LogFile != NULL; }
+
+	/** appends event, safe to call from any thread */
+	void Record(EShooterCombatEvent::Type Type, uint8 Flags, uint16 Param, int32 InstigatorId, int32 TargetId, float Value, const FVector& Location);
+
+	/** get player id of controller or pawn, INDEX_NONE without player state */
+	static int32 GetPlayerId(const AController* Controller);
+	static int32 GetPlayerId(const APawn* Pawn);
+
+	/** get bot flag of controller */
+	static uint8 GetInstigatorFlags(const AController* Controller);
+
+	/** parses log data, returns false with error message when it's not a supported log */
+	static bool ReadLog(const TArray<uint8>& Data, FShooterCombatLogHeader& OutHeader, TArray<FShooterCombatRecord>& OutRecords, FString& OutError);
+
+	/** get display name of event type */
+	static const TCHAR* GetEventName(uint8 Type);
+
+	/** counters of current or last recording */
+	struct FStats
+	{
+		/** events recorded */
+		int32 NumRecorded;
+
+		/** events lost to full buffers */
+		int32 NumDropped;
+
+		/** bytes written to log */
+		int64 NumBytesWritten;
+
+		/** average time spent recording event (ns) */
+		double AverageRecordTime;
+	};
+
+	FStats GetStats() const;
+
+	/** get path of current or last log */
+	const FString& GetLogPath() const { return LogPath; }
+
+	/** get budget of average time per recorded event (ns) */
+	static float GetEventBudget();
+
+	// Begin FRunnable interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	// End FRunnable interface
+
+private:
+
+	enum
+	{
+		/** records per thread buffer, power of two */
+		BufferSize = 4096,
+
+		/** threads which may record at the same time */
+		MaxBuffers = 16,
+	};
+
+	/** single producer, single consumer ring of records */
+	struct FThreadBuffer
+	{
+		/** thread appending records */
+		uint32 ThreadId;
+
+		/** next record to write, only changed by owning thread */
+		TAtomic<uint32> Head;
+
+		/** next record to flush, only changed by flush thread */
+		TAtomic<uint32> Tail;
+
+		/** counters, only changed by owning thread */
+		TAtomic<uint32> NumRecorded;
+		TAtomic<uint32> NumDropped;
+		TAtomic<uint64> RecordCycles;
+
+		FShooterCombatRecord Records[BufferSize];
+
+		FThreadBuffer(uint32 InThreadId);
+	};
+
+	/** get buffer of calling thread, registers new one on first use. NULL when out of buffers */
+	FThreadBuffer* GetThreadBuffer();
+
+	/** writes pending records of all buffers to log, flush thread */
+	void FlushBuffers();
+
+	/** world of recorded matches */
+	TWeakObjectPtr<UWorld> World;
+
+	/** registered buffers, only appended to */
+	FThreadBuffer* Buffers[MaxBuffers];
+	TAtomic<int32> NumBuffers;
+
+	/** guards registering of buffers */
+	FCriticalSection BuffersCriticalSection;
+
+	/** events of threads which found no free buffer, any thread */
+	TAtomic<uint32> NumDroppedWithoutBuffer;
+
+	/** running out of buffers was reported */
+	TAtomic<bool> bReportedOutOfBuffers;
+
+	/** log being written, only used by flush thread while recording */
+	IFileHandle* LogFile;
+	FString LogPath;
+
+	/** staging of records written in one go, flush thread */
+	TArray<FShooterCombatRecord> FlushRecords;
+
+	/** drains buffers periodically */
+	FRunnableThread* FlushThread;
+
+	/** wakes flush thread early */
+	FEvent* FlushEvent;
+
+	/** asks flush thread to finish */
+	TAtomic<bool> bStopFlushing;
+
+	/** platform time of recording start */
+	double StartSeconds;
+
+	/** bytes written to log, flush thread */
+	TAtomic<int64> NumBytesWritten;
+
+	/** counters of buffers at recording start, stats only cover current recording */
+	uint32 BaseNumRecorded;
+	uint32 BaseNumDropped;
+	uint64 BaseRecordCycles;
+};
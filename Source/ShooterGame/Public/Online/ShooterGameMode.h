@@ -4,6 +4,15 @@
 
 #include "OnlineIdentityInterface.h"
 #include "ShooterPlayerController.h"
+#include "ShooterBotPathQueue.h"
+#include "ShooterPawnOccupancyGrid.h"
+#include "ShooterTeamInfluenceMap.h"
+#include "ShooterRadialDamage.h"
+#include "ShooterProjectilePool.h"
+#include "ShooterCombatRecorder.h"
+#include "ShooterChatService.h"
+#include "ShooterServerMetrics.h"
+#include "ShooterTickRateGovernor.h"
 #include "ShooterGameMode.generated.h"
 
 class AShooterAIController;
@@ -25,6 +34,12 @@ class AShooterGameMode : public AGameMode
 
 	virtual void PreInitializeComponents() override;
 
+	/** dispatches bot path requests */
+	virtual void Tick(float DeltaSeconds) override;
+
+	/** finishes combat log */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/** Initialize the game. This is called before actors' PreInitializeComponents. */
 	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
 
@@ -73,7 +88,7 @@ class AShooterGameMode : public AGameMode
 	/** hides the onscreen hud and restarts the map */
 	virtual void RestartGame() override;
 
-	/** Creates AIControllers for all bots */
+	/** Queues creation of AIControllers for all bots */
 	void CreateBotControllers();
 
 	/** Create a bot */
@@ -109,6 +124,22 @@ protected:
 	UPROPERTY(config)
 	int32 MaxBots;
 
+	/** max number of bots created or spawned in one frame, 0 = no limit */
+	UPROPERTY(config)
+	int32 BotSpawnsPerFrame;
+
+	/** max time spent on creating and spawning bots in one frame (ms), 0 = no limit */
+	UPROPERTY(config)
+	float BotSpawnBudgetMs;
+
+	/** enemies closer to spawn point than this make it less desirable */
+	UPROPERTY(config)
+	float SpawnThreatRadius;
+
+	/** scale of enemy team influence in spawn point rating, one pawn standing still builds up about 20 */
+	UPROPERTY(config)
+	float SpawnInfluenceWeight;
+
 	UPROPERTY()
 	TArray<AShooterAIController*> BotControllers;
 
@@ -122,9 +153,71 @@ protected:
 
 	bool bAllowBots;		
 
+	/** async path requests of bots */
+	FShooterBotPathQueue BotPathQueue;
+
+	/** number of bot controllers waiting for creation */
+	int32 NumPendingBotCreations;
+
+	/** number used for name of next created bot */
+	int32 NextBotNum;
+
+	/** bots waiting for first spawn of the match, in spawn order */
+	TArray<TWeakObjectPtr<AShooterAIController>> PendingBotSpawns;
+
+	/** all spawn points of level, built on first spawn */
+	UPROPERTY()
+	TArray<APlayerStart*> SpawnPoints;
+
+	/** indices to SpawnPoints allowed for team and bot combination, see GetSpawnPointsKey */
+	TMap<int32, TArray<int32>> AllowedSpawnPoints;
+
+	/** "Play from Here" spawn point */
+	UPROPERTY()
+	APlayerStart* PIESpawnPoint;
+
+	/** were spawn points gathered? */
+	bool bSpawnPointsCached;
+
+	/** pawn capsules, for spawn point rating. Lazily rebuilt each frame from const queries */
+	mutable FShooterPawnOccupancyGrid PawnOccupancyGrid;
+
+	/** where teams are and fight, for spawn point rating and bots */
+	FShooterTeamInfluenceMap TeamInfluenceMap;
+
+	/** explosion damage of grenades and projectiles */
+	FShooterRadialDamageService RadialDamageService;
+
+	/** reusable projectiles and grenades */
+	FShooterProjectilePool ProjectilePool;
+
+	/** binary log of combat events of current match */
+	FShooterCombatRecorder CombatRecorder;
+
+	/** rate limited, batched chat */
+	FShooterChatService ChatService;
+
+	/** server health snapshots for fleet monitoring */
+	FShooterServerMetrics ServerMetrics;
+
+	/** adjusts server tick rate by load */
+	FShooterTickRateGovernor TickRateGovernor;
+
+	/** frames used by current bot creation and spawn burst */
+	int32 BotQueueFrames;
+
+	/** bots processed in current burst */
+	int32 BotQueueProcessed;
+
+	/** longest frame of current burst (ms) */
+	double BotQueueWorstFrameMs;
+
 	/** spawning all bots for this game */
 	void StartBots();
 
+	/** creates and spawns queued bots, within frame budget */
+	void ProcessBotQueue();
+
 	/** initialization for bot after creation */
 	virtual void InitBot(AShooterAIController* AIC, int32 BotNum);
 
@@ -140,6 +233,18 @@ protected:
 	/** check if player should use spawnpoint */
 	virtual bool IsSpawnpointPreferred(APlayerStart* SpawnPoint, AController* Player) const;
 
+	/** rate spawnpoint for player, higher is better. Checks blockage and enemies nearby with occupancy grid, recent enemy presence with team influence map */
+	virtual float RateSpawnpoint(APlayerStart* SpawnPoint, AController* Player, bool& bOutBlocked) const;
+
+	/** gathers level spawn points */
+	void CacheSpawnPoints();
+
+	/** get spawn points allowed for player */
+	const TArray<int32>& GetAllowedSpawnPoints(AController* Player);
+
+	/** get key of AllowedSpawnPoints for player */
+	int32 GetSpawnPointsKey(AController* Player) const;
+
 	/** Returns game session class to use */
 	virtual TSubclassOf<AGameSession> GetGameSessionClass() const override;	
 
@@ -156,6 +261,31 @@ public:
 	/** get the name of the bots count option used in server travel URL */
 	static FString GetBotsCountOptionName();
 
+	/** get async path requests queue of bots */
+	FShooterBotPathQueue& GetBotPathQueue() { return BotPathQueue; }
+
+	/** get influence map of teams */
+	FShooterTeamInfluenceMap& GetTeamInfluenceMap() { return TeamInfluenceMap; }
+	const FShooterTeamInfluenceMap& GetTeamInfluenceMap() const { return TeamInfluenceMap; }
+
+	/** get radial damage service used by explosions */
+	FShooterRadialDamageService& GetRadialDamageService() { return RadialDamageService; }
+
+	/** get pool of projectiles and grenades */
+	FShooterProjectilePool& GetProjectilePool() { return ProjectilePool; }
+
+	/** get recorder of combat events */
+	FShooterCombatRecorder& GetCombatRecorder() { return CombatRecorder; }
+
+	/** get chat service */
+	FShooterChatService& GetChatService() { return ChatService; }
+
+	/** get server health metrics */
+	FShooterServerMetrics& GetServerMetrics() { return ServerMetrics; }
+
+	/** get server tick rate governor */
+	FShooterTickRateGovernor& GetTickRateGovernor() { return TickRateGovernor; }
+
 	UPROPERTY()
 	TArray<AShooterPickup*> LevelPickups;
 
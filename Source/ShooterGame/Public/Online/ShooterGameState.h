@@ -2,7 +2,13 @@
 
 #pragma once
 
+#include "ShooterTypes.h"
 #include "ShooterOnlineGameMatches.h"
+#include "ShooterProjectileManager.h"
+#include "ShooterImpactEffectManager.h"
+#include "ShooterAudioManager.h"
+#include "ShooterRagdollManager.h"
+#include "ShooterMatchEndPipeline.h"
 #include "ShooterGameState.generated.h"
 
 /** ranked PlayerState map, created from the GameState */
@@ -31,6 +37,21 @@ public:
 	UPROPERTY(Transient, Replicated)
 	bool bTimerPaused;
 
+	/** damage types of kills so far, kill feed refers to them by index */
+	UPROPERTY(Transient, ReplicatedUsing=OnRep_KillFeedDamageTypes)
+	TArray<TSubclassOf<UDamageType>> KillFeedDamageTypes;
+
+	/** queues kill for clients, all kills of a frame are sent together */
+	void AddKillFeedEntry(AShooterPlayerState* KillerPlayerState, AShooterPlayerState* VictimPlayerState, const UDamageType* KillerDamageType);
+
+	/** sends kills of this frame to clients, one message for all of them */
+	UFUNCTION(Reliable, NetMulticast)
+	void MulticastKillFeed(const TArray<FShooterKillFeedEntry>& Entries);
+
+	/** shows kills waiting for their damage types */
+	UFUNCTION()
+	void OnRep_KillFeedDamageTypes();
+
 	/** gets ranked PlayerState map for specific team */
 	void GetRankedMap(int32 TeamIndex, RankedPlayerMap& OutRankedMap) const;	
 
@@ -39,6 +60,25 @@ public:
 	virtual void HandleMatchHasStarted() override;
 	virtual void HandleMatchHasEnded() override;
 
+	virtual void PostInitializeComponents() override;
+	virtual void Tick(float DeltaSeconds) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** get batched simulation of projectiles */
+	FShooterProjectileManager& GetProjectileManager() { return ProjectileManager; }
+
+	/** get budgeted player of weapon impact effects */
+	FShooterImpactEffectManager& GetImpactEffectManager() { return ImpactEffectManager; }
+
+	/** get pooled player of gameplay sounds */
+	FShooterAudioManager& GetAudioManager() { return AudioManager; }
+
+	/** get budget of simulated ragdolls */
+	FShooterRagdollManager& GetRagdollManager() { return RagdollManager; }
+
+	/** get queue of time sliced end of match work */
+	FShooterMatchEndPipeline& GetMatchEndPipeline() { return MatchEndPipeline; }
+
 protected:
 	UPROPERTY(config)
 	FString ActivityId;
@@ -47,4 +87,37 @@ protected:
 	bool bEnableGameFeedback;
 
 	FShooterOnlineGameMatches GameMatches;
+
+	/** moves projectiles on server and clients */
+	FShooterProjectileManager ProjectileManager;
+
+	/** plays weapon impact effects within budgets */
+	FShooterImpactEffectManager ImpactEffectManager;
+
+	/** plays gameplay sounds within voice budget */
+	FShooterAudioManager AudioManager;
+
+	/** limits and freezes ragdolls of dead pawns */
+	FShooterRagdollManager RagdollManager;
+
+	/** spreads end of match work over several frames */
+	FShooterMatchEndPipeline MatchEndPipeline;
+
+	/** kills of this frame, server */
+	TArray<FShooterKillFeedEntry> PendingKillFeed;
+
+	/** received kills with damage types not replicated yet, client */
+	TArray<FShooterKillFeedEntry> UnresolvedKillFeed;
+
+	/** handle of SendKillFeed registration */
+	FDelegateHandle PostActorTickHandle;
+
+	/** sends pending kills after all actors ticked, before replication */
+	void SendKillFeed(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	/** passes kills to local players, returns false when damage type isn't known yet */
+	bool ShowKillFeedEntry(const FShooterKillFeedEntry& Entry);
+
+	/** find player state by PlayerId */
+	AShooterPlayerState* FindPlayerState(int32 PlayerId) const;
 };
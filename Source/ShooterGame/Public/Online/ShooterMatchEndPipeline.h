@@ -0,0 +1,84 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+ * Runs end of match work as queued jobs, so locking pawns, notifying players, saving profiles and online writes
+ * don't all land in the frame match ends. Jobs run on game thread in order they were queued, as many per frame as
+ * fit in time budget but always at least one. Pending jobs are flushed when the game state goes away.
+ * Owned by the game state, used on server and clients.
+ */
+class FShooterMatchEndPipeline
+{
+public:
+
+	struct FRunStats
+	{
+		/** jobs executed */
+		int32 NumJobs;
+
+		/** frames jobs were spread over */
+		int32 NumFrames;
+
+		/** time spent in jobs (ms) */
+		double TotalTime;
+
+		/** time spent in jobs in most expensive frame (ms) */
+		double LongestFrameTime;
+
+		/** most expensive job and its time (ms) */
+		const TCHAR* LongestJobName;
+		double LongestJobTime;
+	};
+
+	FShooterMatchEndPipeline();
+
+	/** get pipeline of world */
+	static FShooterMatchEndPipeline* Get(const UObject* WorldContextObject);
+
+	/** queue job, runs within next frames */
+	void AddJob(const TCHAR* Name, TFunction<void()>&& Job);
+
+	/** runs queued jobs within frame budget */
+	void Tick();
+
+	/** runs all queued jobs, including ones they queue */
+	void Flush();
+
+	/** get number of jobs waiting */
+	int32 GetNumPendingJobs() const { return Jobs.Num() - NextJob; }
+
+	/** get stats of last finished run */
+	const FRunStats& GetLastRunStats() const { return LastRunStats; }
+
+	/** queue job in pipeline of world, without pipeline or with time slicing disabled it runs right away */
+	static void QueueJob(const UObject* WorldContextObject, const TCHAR* Name, TFunction<void()>&& Job);
+
+private:
+
+	struct FJob
+	{
+		/** static name, for stats */
+		const TCHAR* Name;
+
+		TFunction<void()> Function;
+	};
+
+	/** runs first pending job and updates stats */
+	void RunNextJob();
+
+	/** finishes stats of run once queue is empty */
+	void FinishRun();
+
+	/** queued jobs, executed ones are before NextJob */
+	TArray<FJob> Jobs;
+
+	/** index of first pending job */
+	int32 NextJob;
+
+	/** stats of current run */
+	FRunStats RunStats;
+
+	/** stats of last finished run */
+	FRunStats LastRunStats;
+};
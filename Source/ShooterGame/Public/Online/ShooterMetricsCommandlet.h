@@ -0,0 +1,20 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "ShooterMetricsCommandlet.generated.h"
+
+/**
+ * Stand-in for fleet scraper: reads snapshot file written by FShooterServerMetrics, checks every line and prints latest snapshot.
+ * Usage: -run=ShooterMetrics -File=<path to .jsonl> [-MinSnapshots=N] to fail when fewer snapshots were written.
+ */
+UCLASS()
+class UShooterMetricsCommandlet : public UCommandlet
+{
+	GENERATED_UCLASS_BODY()
+
+	// Begin UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	// End UCommandlet interface
+};
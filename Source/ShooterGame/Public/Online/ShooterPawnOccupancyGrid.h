@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+class AShooterPlayerState;
+
+/**
+ * 2D hash grid of pawn capsules, rebuilt at most once per frame.
+ * Used by spawn point selection to test blockage and nearby enemies without walking all pawns for every spawn point.
+ */
+class FShooterPawnOccupancyGrid
+{
+public:
+
+	struct FEntry
+	{
+		/** capsule center */
+		FVector Location;
+
+		/** direction pawn is looking at */
+		FVector ViewDirection;
+
+		float Radius;
+
+		float HalfHeight;
+
+		/** owner of pawn, valid only in frame of build */
+		AShooterPlayerState* PlayerState;
+
+		bool bAlive;
+	};
+
+	FShooterPawnOccupancyGrid();
+
+	/** rebuild grid, if it wasn't done this frame yet */
+	void Update(UWorld* World);
+
+	/** adds pawn spawned after this frame's rebuild, so later spawns of the same frame see it */
+	void AddSpawnedPawn(ACharacter* Pawn);
+
+	/** calls Func for every pawn which may be within Radius (2D) of Location */
+	template<typename FuncType>
+	void ForEachPawnNear(const FVector& Location, float Radius, FuncType Func) const
+	{
+		const FIntPoint MinCell = GetCell(Location - FVector(Radius, Radius, 0.0f));
+		const FIntPoint MaxCell = GetCell(Location + FVector(Radius, Radius, 0.0f));
+		for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+			{
+				if (const TArray<int32, TInlineAllocator<4>>* CellEntries = Cells.Find(FIntPoint(X, Y)))
+				{
+					for (int32 EntryIdx : *CellEntries)
+					{
+						Func(Entries[EntryIdx]);
+					}
+				}
+			}
+		}
+	}
+
+private:
+
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/** adds capsule of pawn */
+	void AddPawn(ACharacter* Pawn);
+
+	/** size of grid cell (uu) */
+	float CellSize;
+
+	/** frame of last rebuild */
+	uint64 LastUpdateFrame;
+
+	/** all pawns */
+	TArray<FEntry> Entries;
+
+	/** indices to Entries, by cell */
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<4>>> Cells;
+};
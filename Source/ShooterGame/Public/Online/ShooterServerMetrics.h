@@ -0,0 +1,118 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+class FJsonObject;
+
+/** keeps work time of recent frames without idle time (ms) in a fixed ring, shared by metrics and tick rate governor */
+class FShooterFrameWorkSampler
+{
+public:
+
+	enum
+	{
+		/** frames kept, older ones are overwritten */
+		MaxSamples = 1024,
+	};
+
+	FShooterFrameWorkSampler();
+
+	/** samples work time of frame that just finished */
+	void AddFrame();
+
+	/** drops all samples */
+	void Reset();
+
+	/** sorts samples for percentiles, call after last AddFrame */
+	void Sort();
+
+	/** get sorted sample at percentile (0..1), 0 without samples */
+	float GetPercentile(float Percentile) const;
+
+	/** get longest sorted sample, 0 without samples */
+	float GetMax() const;
+
+	/** get number of samples kept */
+	int32 Num() const { return NumSamples; }
+
+private:
+
+	float Samples[MaxSamples];
+	int32 NumSamples;
+	int32 NextSample;
+
+	/** reused for percentiles */
+	TArray<float> SortedSamples;
+};
+
+/**
+ * Writes periodic snapshots of server health to a JSON lines file for fleet monitoring: tick time percentiles,
+ * player and bot counts, ping and bandwidth of each connection, replication graph counters, garbage collection
+ * time and memory. Ticks only store frame time in a fixed ring, everything else is gathered when snapshot is written.
+ * Owned by the game mode, enabled on dedicated servers.
+ */
+class FShooterServerMetrics
+{
+public:
+
+	FShooterServerMetrics();
+	~FShooterServerMetrics();
+
+	/** sets world to sample and starts timing garbage collection */
+	void Initialize(UWorld* InWorld);
+
+	/** get metrics of world, NULL on clients */
+	static FShooterServerMetrics* Get(const UObject* WorldContextObject);
+
+	/** samples frame time, writes snapshot when interval passed */
+	void Tick();
+
+	/** writes snapshot right away, even when disabled. Returns written line */
+	FString WriteSnapshot();
+
+	/** get file snapshots are appended to */
+	FString GetFilePath() const;
+
+	/** snapshots written and cost of last one (ms) */
+	int32 NumSnapshots;
+	double LastSnapshotTime;
+
+	/** parses snapshot file like a scraper would, returns false with error when a line is malformed or misses fields */
+	static bool ReadSnapshots(const FString& Text, TArray<TSharedPtr<FJsonObject>>& OutSnapshots, FString& OutError);
+
+private:
+
+	/** gathers snapshot and resets interval counters */
+	TSharedRef<FJsonObject> BuildSnapshot();
+
+	/** appends line to file, rotates file when it's too big */
+	void AppendLine(const FString& Line);
+
+	void OnPreGarbageCollect();
+	void OnPostGarbageCollect();
+
+	/** world to sample */
+	TWeakObjectPtr<UWorld> World;
+
+	/** work time of frames since last snapshot */
+	FShooterFrameWorkSampler FrameSamples;
+
+	/** frames and their total time including idle time (s) since last snapshot */
+	int32 NumFrames;
+	double TotalFrameTime;
+
+	/** platform time of last snapshot */
+	double LastSnapshotSeconds;
+
+	/** garbage collections since last snapshot, their total and longest time (ms) */
+	int32 NumCollections;
+	double CollectionTime;
+	double MaxCollectionTime;
+	double CollectionStartSeconds;
+
+	FDelegateHandle PreGarbageCollectHandle;
+	FDelegateHandle PostGarbageCollectHandle;
+
+	/** file being appended to */
+	FArchive* File;
+};
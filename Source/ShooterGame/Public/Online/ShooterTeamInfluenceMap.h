@@ -0,0 +1,105 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+class AShooterCharacter;
+class AShooterPlayerState;
+
+/**
+ * Coarse 2D influence map with one layer per team. Pawn positions are stamped at fixed interval and weapon fire
+ * stamps the shooter's location, values decay over time. Decay is applied lazily per cell, so reads are O(1).
+ * In free for all game all pawns share layer 0, and each player's own stamps are also kept apart so they can be
+ * taken out of enemy influence.
+ * Owned and ticked by the game mode, used for spawn point rating and bot positioning.
+ */
+class FShooterTeamInfluenceMap
+{
+public:
+
+	FShooterTeamInfluenceMap();
+
+	/** sets world used for gathering pawns and time */
+	void Initialize(UWorld* InWorld);
+
+	/** stamps pawn positions, when interval elapsed */
+	void Tick(float DeltaSeconds);
+
+	/** stamps weapon fire of Shooter */
+	void NotifyWeaponFired(const AShooterCharacter* Shooter);
+
+	/** adds influence of team at location, spread to neighbour cells. Owner is needed to tell players apart in free for all */
+	void AddInfluence(const FVector& Location, int32 TeamNum, float Amount, const AShooterPlayerState* Owner = NULL);
+
+	/** get current influence of team at location */
+	float GetInfluence(const FVector& Location, int32 TeamNum) const;
+
+	/** get current influence of teams hostile to TeamNum at location. In free for all, influence of Requester is left out */
+	float GetEnemyInfluence(const FVector& Location, int32 TeamNum, const AShooterPlayerState* Requester = NULL) const;
+
+	/**
+	 * Finds center of visited cell within Radius, either with least enemy influence (retreat)
+	 * or where team dominates contested area (advance). Z is copied from Origin.
+	 */
+	bool FindLocationNear(const FVector& Origin, float Radius, int32 TeamNum, bool bAdvance, FVector& OutLocation, const AShooterPlayerState* Requester = NULL) const;
+
+	/** get size of grid cell (uu) */
+	float GetCellSize() const { return CellSize; }
+
+	/** drop all influence */
+	void Reset();
+
+private:
+
+	enum { MaxTeams = 4 };
+
+	struct FCell
+	{
+		float Influence[MaxTeams];
+
+		/** world time of last decay */
+		float LastUpdateTime;
+	};
+
+	struct FOwnCell
+	{
+		float Influence;
+
+		/** world time of last decay */
+		float LastUpdateTime;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/** get decay factor of influence last updated at LastUpdateTime */
+	float GetDecay(float LastUpdateTime) const;
+
+	/** get influence of every team in cell, decayed to current time */
+	void GetDecayedInfluence(const FCell& Cell, float OutInfluence[MaxTeams]) const;
+
+	/** get current influence stamped by player at location, free for all only */
+	float GetOwnInfluence(const FVector& Location, const AShooterPlayerState* PlayerState) const;
+
+	/** check if all pawns share layer 0 */
+	bool IsFreeForAll() const;
+
+	/** get layer used by team */
+	int32 GetLayer(int32 TeamNum) const;
+
+	/** get current world time */
+	float GetTime() const;
+
+	/** world of game mode */
+	TWeakObjectPtr<UWorld> World;
+
+	/** size of grid cell (uu) */
+	float CellSize;
+
+	/** time left to next stamp of pawn positions */
+	float TimeToPositionStamp;
+
+	/** visited cells */
+	TMap<FIntPoint, FCell> Cells;
+
+	/** cells stamped by each player, free for all only */
+	TMap<TWeakObjectPtr<const AShooterPlayerState>, TMap<FIntPoint, FOwnCell>> OwnCells;
+};
@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ShooterServerMetrics.h"
+
+/**
+ * Adjusts server tick rate within bounds by measured load: lowers it when frames use most of their budget, raises it
+ * again when frames would fit the budget of the higher rate with headroom for several intervals in a row. Load is only
+ * judged over intervals without players joining or leaving. Replication periods and bot think intervals are recomputed
+ * on each change, so their rates in real time stay the same. Owned by the game mode, dedicated servers only.
+ */
+class FShooterTickRateGovernor
+{
+public:
+
+	FShooterTickRateGovernor();
+
+	/** sets world whose net driver is governed */
+	void Initialize(UWorld* InWorld);
+
+	/** get governor of world, NULL on clients */
+	static FShooterTickRateGovernor* Get(const UObject* WorldContextObject);
+
+	/** measures frame, adjusts tick rate once interval passed */
+	void Tick();
+
+	/** sets tick rate within bounds, recomputes replication periods and bot think intervals */
+	void SetTickRate(int32 NewTickRate);
+
+	/** get current server tick rate, 0 without net driver */
+	int32 GetTickRate() const;
+
+	/** get tick rate set in config, default upper bound */
+	int32 GetConfiguredTickRate() const;
+
+	/** tick rate changes since last reset */
+	int32 NumRaised;
+	int32 NumLowered;
+
+	/** clears counters */
+	void ResetStats();
+
+private:
+
+	/** starts new measuring interval */
+	void ResetWindow(int32 NumPlayers);
+
+	/** world whose net driver is governed */
+	TWeakObjectPtr<UWorld> World;
+
+	/** work time of frames in current interval */
+	FShooterFrameWorkSampler WorkSamples;
+
+	/** platform time of interval start */
+	double WindowStartSeconds;
+
+	/** players and bots at interval start */
+	int32 WindowNumPlayers;
+
+	/** intervals in a row with headroom for higher rate */
+	int32 NumHeadroomWindows;
+};
@@ -104,15 +104,18 @@ class AShooterCharacter : public ACharacter
 	/** check if pawn can reload weapon */
 	bool CanReload() const;
 
-	/** [server + local] change targeting state */
+	/** [server + local] change targeting state, sent to server with movement */
 	void SetTargeting(bool bNewTargeting);
 
 	//////////////////////////////////////////////////////////////////////////
 	// Movement
 
-	/** [server + local] change running state */
+	/** [server + local] change running state, sent to server with movement */
 	void SetRunning(bool bNewRunning, bool bToggle);
 
+	/** [local] set running and targeting of replayed move, without effects */
+	void SetMovementModifiers(bool bNewRunning, bool bNewTargeting);
+
 	//////////////////////////////////////////////////////////////////////////
 	// Animations
 
@@ -250,6 +253,9 @@ class AShooterCharacter : public ACharacter
 	UFUNCTION(BlueprintCallable, Category = Pawn)
 	bool IsRunning() const;
 
+	/** get running state requested by player, even when not moving */
+	bool WantsToRun() const { return bWantsToRun; }
+
 	/** get camera view type */
 	UFUNCTION(BlueprintCallable, Category = Mesh)
 	virtual bool IsFirstPerson() const;
@@ -373,10 +379,16 @@ protected:
 	UPROPERTY()
 	UAudioComponent* RunLoopAC;
 
+	/** world time when lost run loop may ask for a new voice again */
+	float NextRunLoopRequestTime;
+
 	/** hook to looped low health sound used to stop/adjust volume */
 	UPROPERTY()
 	UAudioComponent* LowHealthWarningPlayer;
 
+	/** world time when lost low health loop may ask for a new voice again */
+	float NextLowHealthRequestTime;
+
 	/** handles sounds for running */
 	void UpdateRunSounds();
 
@@ -444,6 +456,15 @@ protected:
 	/** switch to ragdoll */
 	void SetRagdollPhysics();
 
+	/** returns false if death animation isn't playing, otherwise schedules HoldDeathPose for its end */
+	bool StartDeathPoseHold();
+
+	/** pauses death animation at its last frame before blend out, mesh is frozen shortly after */
+	void HoldDeathPose();
+
+	/** stops mesh update, keeping pose of death animation */
+	void FreezeDeathPose();
+
 	/** sets up the replication for taking a hit */
 	void ReplicateHit(float Damage, struct FDamageEvent const& DamageEvent, class APawn* InstigatingPawn, class AActor* DamageCauser, bool bKilled);
 
@@ -471,14 +492,6 @@ protected:
 	UFUNCTION(reliable, server, WithValidation)
 	void ServerEquipWeapon(class AShooterWeapon* NewWeapon);
 
-	/** update targeting state */
-	UFUNCTION(reliable, server, WithValidation)
-	void ServerSetTargeting(bool bNewTargeting);
-
-	/** update targeting state */
-	UFUNCTION(reliable, server, WithValidation)
-	void ServerSetRunning(bool bNewRunning, bool bToggle);
-
 	/** Builds list of points to check for pausing replication for a connection*/
 	void BuildPauseReplicationCheckPoints(TArray<FVector>& RelevancyCheckPoints);
 
@@ -509,8 +522,42 @@ private:
     UPROPERTY(Category = "Game|Grenade", EditAnywhere, meta = (AllowPrivateAccess))
     float GrenadeLaunchPitchAngle;
 
+    /** Max distance between the client's throw origin and the server's grenade spawn location */
+    UPROPERTY(Category = "Game|Grenade", EditAnywhere, meta = (AllowPrivateAccess))
+    float GrenadeMaxOriginError;
+
+    /** Min time in seconds between two grenade throws, the server drops throws arriving faster */
+    UPROPERTY(Category = "Game|Grenade", EditAnywhere, meta = (AllowPrivateAccess))
+    float GrenadeThrowInterval;
+
+public:
+    /**
+     * Removes the predicted grenade of the throw from the list of pending predictions
+     * @return The predicted grenade, or nullptr if it's gone already
+     */
+    class AShooterGameGrenade* TakePredictedGrenade(uint8 ThrowId);
+
 private:
     UFUNCTION()
     void OnLaunchGrenadeInputActionPressed();
+
+    /** Spawns the grenade and sets up its launch */
+    class AShooterGameGrenade* SpawnGrenade(const FVector& Origin, const FVector& Direction, float LaunchTime, uint8 ThrowId, bool bPredicted);
+
+    /** Throws the grenade on the server, LaunchTime is the client's estimate of the server world time */
+    UFUNCTION(reliable, server, WithValidation)
+    void ServerLaunchGrenade(FVector_NetQuantize Origin, FVector_NetQuantizeNormal Direction, float LaunchTime, uint8 ThrowId);
+
+    /** Locally spawned grenades waiting for the server's grenade */
+    TArray<TWeakObjectPtr<class AShooterGameGrenade>> PredictedGrenades;
+
+    /** Id of the last grenade thrown by this client, on the server the last one accepted */
+    uint8 LastGrenadeThrowId;
+
+    /** World time of the last grenade thrown */
+    float LastGrenadeThrowTime;
+
+    /** Checks the throw interval and records the throw when it's allowed */
+    bool ConsumeGrenadeThrow(float MinInterval);
 #endif // Shooter Game Kevin Character
 };
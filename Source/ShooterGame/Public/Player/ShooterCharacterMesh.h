@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ * Third person mesh of shooter characters, with animation LOD for remote pawns.
+ */
+
+#pragma once
+#include "ShooterCharacterMesh.generated.h"
+
+/** how often mesh of pawn evaluates its animation */
+namespace EShooterAnimLOD
+{
+	enum Type
+	{
+		/** locally controlled, always at full rate */
+		Local,
+		/** remote, on screen at full rate */
+		Full,
+		/** remote, on screen with skipped frames */
+		Reduced,
+		/** remote, not rendered: montages only */
+		Offscreen,
+		MAX,
+	};
+}
+
+UCLASS()
+class UShooterCharacterMesh : public USkeletalMeshComponent
+{
+	GENERATED_UCLASS_BODY()
+
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/** switch between full rate animation of locally controlled pawns and animation LOD of remote ones */
+	void SetRemoteAnimationLOD(bool bRemote);
+
+	/** get tier of animation LOD mesh is in */
+	EShooterAnimLOD::Type GetAnimLOD() const;
+
+	struct FAnimLODStats
+	{
+		/** mesh ticks in tier */
+		int32 NumTicks;
+
+		/** game thread time of those ticks (s), animation evaluated on worker threads isn't part of it */
+		double GameThreadTime;
+	};
+
+	/** counters of all meshes, by tier */
+	static FAnimLODStats AnimLODStats[EShooterAnimLOD::MAX];
+
+protected:
+
+	/** sets screen size thresholds of update rate optimizations */
+	void OnUpdateRateParamsCreated(FAnimUpdateRateParameters* Params);
+
+	/** is using animation LOD of remote pawns? */
+	uint8 bRemoteAnimationLOD : 1;
+};
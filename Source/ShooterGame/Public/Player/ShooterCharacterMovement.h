@@ -7,11 +7,61 @@
 #pragma once
 #include "ShooterCharacterMovement.generated.h"
 
+/** saved move with running and targeting, so their speed modifiers are predicted and replayed with movement */
+class FSavedMove_Shooter : public FSavedMove_Character
+{
+public:
+
+	typedef FSavedMove_Character Super;
+
+	virtual void Clear() override;
+	virtual uint8 GetCompressedFlags() const override;
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, class FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+
+	/** running requested during move */
+	uint8 bSavedWantsToRun : 1;
+
+	/** targeting during move */
+	uint8 bSavedIsTargeting : 1;
+};
+
+class FNetworkPredictionData_Client_Shooter : public FNetworkPredictionData_Client_Character
+{
+public:
+
+	typedef FNetworkPredictionData_Client_Character Super;
+
+	FNetworkPredictionData_Client_Shooter(const UCharacterMovementComponent& ClientMovement);
+
+	virtual FSavedMovePtr AllocateNewMove() override;
+};
+
 UCLASS()
 class UShooterCharacterMovement : public UCharacterMovementComponent
 {
 	GENERATED_UCLASS_BODY()
 
 	virtual float GetMaxSpeed() const override;
+
+	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+	virtual bool ClientUpdatePositionAfterServerUpdate() override;
+
+	/** switch between full walking simulation and navmesh walking without capsule sweeps, at reduced tick rate */
+	void SetReducedMovementLOD(bool bReduced);
+
+	/** is using reduced movement LOD? */
+	bool IsReducedMovementLOD() const { return bReducedMovementLOD; }
+
+protected:
+
+	/** tick interval while using reduced movement LOD */
+	UPROPERTY(EditDefaultsOnly, Category="Character Movement: LOD")
+	float ReducedLODTickInterval;
+
+	/** is using reduced movement LOD? */
+	uint8 bReducedMovementLOD : 1;
 };
 
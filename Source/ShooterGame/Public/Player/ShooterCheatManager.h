@@ -29,4 +29,40 @@ class UShooterCheatManager : public UCheatManager
 
 	UFUNCTION(exec)
 	void SpawnBot();
+
+	/** measures radial damage cost against growing number of actors in explosion radius */
+	UFUNCTION(exec)
+	void ExplosionBenchmark(int32 MaxActors = 64, int32 Iterations = 100);
+
+	/** prints hit rate and savings of projectile pool, optionally clearing counters */
+	UFUNCTION(exec)
+	void ProjectilePoolStats(bool bReset = false);
+
+	/** prints remote weapon fire simulations per cosmetic LOD, optionally clearing counters */
+	UFUNCTION(exec)
+	void WeaponFireLODStats(bool bReset = false);
+
+	/** prints active voices and counters of audio manager per sound category, optionally clearing counters */
+	UFUNCTION(exec)
+	void AudioVoiceStats(bool bReset = false);
+
+	/** prints simulated ragdolls and budget decisions, optionally clearing counters */
+	UFUNCTION(exec)
+	void RagdollStats(bool bReset = false);
+
+	/** prints game thread animation time of character meshes per LOD tier and time saved against full rate, optionally clearing counters */
+	UFUNCTION(exec)
+	void AnimLODStats(bool bReset = false);
+
+	/** prints jobs, frames and time of last finished match end pipeline run */
+	UFUNCTION(exec)
+	void MatchEndStats();
+
+	/** prints events recorded to combat log and recording cost against budget */
+	UFUNCTION(exec)
+	void CombatLogStats();
+
+	/** prints chat messages sent and rejected and RPCs used for them, optionally clearing counters */
+	UFUNCTION(exec)
+	void ChatStats(bool bReset = false);
 };
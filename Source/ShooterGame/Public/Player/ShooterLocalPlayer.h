@@ -21,10 +21,19 @@ public:
 	/** Initializes the PersistentUser */
 	void LoadPersistentUser();
 
+	/** Starts loading the PersistentUser in background, GetPersistentUser still loads it right away if asked earlier */
+	void LoadPersistentUserAsync();
+
 private:
+	/** Gets save slot and platform user of the PersistentUser */
+	void GetPersistentUserSlot(FString& OutSaveGameName, FPlatformUserId& OutPlatformId) const;
+
 	/** Persistent user data stored between sessions (i.e. the user's savegame) */
 	UPROPERTY()
 	class UShooterPersistentUser* PersistentUser;
+
+	/** Save slot being loaded in background, empty when no load is pending */
+	FString PendingPersistentUserSlot;
 };
 
 
@@ -12,7 +12,13 @@ public:
 	/** Loads user persistence data if it exists, creates an empty record otherwise. */
 	static UShooterPersistentUser* LoadPersistentUser(FString SlotName, const int32 UserIndex);
 
-	/** Saves data if anything has changed. */
+	/** Same as LoadPersistentUser, but file is read on worker thread. OnLoaded is called on game thread. */
+	static void LoadPersistentUserAsync(FString SlotName, const int32 UserIndex, TFunction<void(UShooterPersistentUser*)>&& OnLoaded);
+
+	/** Blocks until all saves in flight are written. */
+	static void WaitForPendingSaves();
+
+	/** Saves data if anything has changed. Data is serialized on game thread and written to disk by worker thread. */
 	void SaveIfDirty();
 
 	/** Records the result of a match. */
@@ -118,6 +124,9 @@ protected:
 	/** Triggers a save of this data. */
 	void SavePersistentUser();
 
+	/** Sets up loaded record, or creates an empty one when nothing was loaded. */
+	static UShooterPersistentUser* InitPersistentUser(USaveGame* LoadedSaveGame, const FString& SlotName, const int32 UserIndex);
+
 	/** Lifetime count of kills */
 	UPROPERTY()
 	int32 Kills;
@@ -172,4 +181,7 @@ private:
 	/** The string identifier used to save/load this persistent user. */
 	FString SlotName;
 	int32 UserIndex;
+
+	/** Writes snapshots of this data in background, created on first save. */
+	TSharedPtr<class FShooterPersistentUserWriter, ESPMode::ThreadSafe> Writer;
 };
\ No newline at end of file
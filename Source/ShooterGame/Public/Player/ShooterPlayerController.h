@@ -55,9 +55,17 @@ public:
 	UFUNCTION(exec)
 	virtual void Say(const FString& Msg);
 
+	/** Local function say a string to own team */
+	UFUNCTION(exec)
+	virtual void TeamSay(const FString& Msg);
+
 	/** RPC for clients to talk to server */
 	UFUNCTION(unreliable, server, WithValidation)
-	void ServerSay(const FString& Msg);	
+	void ServerSay(const FString& Msg, uint8 Channel);
+
+	/** chat messages of one frame from server */
+	UFUNCTION(reliable, client)
+	void ClientReceiveChat(const FShooterChatBatch& Batch);
 
 	/** Local function run an emote */
 // 	UFUNCTION(exec)
@@ -312,6 +320,9 @@ public:
 
 	FName	ServerSayString;
 
+	/** sender names of chat messages, filled by server */
+	TArray<FString> ChatNames;
+
 	// Timer used for updating friends in the player tick.
 	float ShooterFriendUpdateTimer;
 
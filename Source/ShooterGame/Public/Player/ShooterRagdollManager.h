@@ -0,0 +1,65 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+class AShooterCharacter;
+
+/**
+ * Limits number of simulated ragdolls. Dying pawns ask for a ragdoll, which is denied when they're far or off screen,
+ * or when budget is full and all simulated ones are closer to local viewers. Simulated ragdolls are frozen once
+ * they settle, put to sleep when they simulate for too long and hidden when they go off screen before settling. Owned by the game state, never grants ragdolls on dedicated servers.
+ */
+class FShooterRagdollManager
+{
+public:
+
+	FShooterRagdollManager();
+
+	/** sets world to look for viewers in */
+	void Initialize(UWorld* InWorld);
+
+	/** get manager of world */
+	static FShooterRagdollManager* Get(const UObject* WorldContextObject);
+
+	/** returns true if pawn may start simulating ragdoll, it's tracked until frozen */
+	bool RequestRagdoll(AShooterCharacter* Pawn);
+
+	/** freezes ragdolls which don't need simulation anymore */
+	void Tick();
+
+	/** stops simulation of mesh, keeping its current pose */
+	static void FreezePose(USkeletalMeshComponent* Mesh);
+
+	/** get number of simulated ragdolls */
+	int32 GetNumActiveRagdolls() const { return Ragdolls.Num(); }
+
+	/** ragdolls granted, denied and frozen early since last reset */
+	int32 NumGranted;
+	int32 NumDenied;
+	int32 NumFrozen;
+
+	/** clears counters */
+	void ResetStats();
+
+private:
+
+	struct FRagdoll
+	{
+		TWeakObjectPtr<AShooterCharacter> Pawn;
+
+		/** world time of ragdoll start */
+		float StartTime;
+	};
+
+	/** ends simulation of ragdoll taken out of budget, hides it if it's still falling */
+	void StopRagdoll(AShooterCharacter* Pawn);
+
+	/** get squared distance from closest local viewer */
+	float GetViewerDistanceSq(const FVector& Location) const;
+
+	/** world to look for viewers in */
+	TWeakObjectPtr<UWorld> World;
+
+	/** simulated ragdolls */
+	TArray<FRagdoll> Ragdolls;
+};
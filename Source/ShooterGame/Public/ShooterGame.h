@@ -8,10 +8,14 @@
 #include "ParticleDefinitions.h"
 #include "SoundDefinitions.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "ShooterGameMode.h"
 #include "ShooterGameState.h"
 #include "ShooterCharacter.h"
 #include "ShooterCharacterMovement.h"
+#include "ShooterCharacterMesh.h"
 #include "ShooterPlayerController.h"
 #include "ShooterGameClasses.h"
 
@@ -21,6 +25,39 @@ class UBehaviorTreeComponent;
 DECLARE_LOG_CATEGORY_EXTERN(LogShooter, Log, All);
 DECLARE_LOG_CATEGORY_EXTERN(LogShooterWeapon, Log, All);
 
+/** cycle counters of game code hot paths, see stat ShooterGame */
+DECLARE_STATS_GROUP(TEXT("ShooterGame"), STATGROUP_ShooterGame, STATCAT_Advanced);
+
+/** CSV profiler categories of game subsystems */
+CSV_DECLARE_CATEGORY_EXTERN(ShooterWeapons);
+CSV_DECLARE_CATEGORY_EXTERN(ShooterCharacters);
+CSV_DECLARE_CATEGORY_EXTERN(ShooterBots);
+CSV_DECLARE_CATEGORY_EXTERN(ShooterUI);
+CSV_DECLARE_CATEGORY_EXTERN(ShooterEffects);
+
+/** times scope in stat ShooterGame, which also shows call count, and adds its time and call count to CSV category */
+#define SHOOTER_SCOPE_CYCLE_COUNTER(Stat, CsvCategory, CsvStat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	CSV_SCOPED_TIMING_STAT(CsvCategory, CsvStat); \
+	CSV_CUSTOM_STAT(CsvCategory, CsvStat##Calls, 1, ECsvCustomStatOp::Accumulate)
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+/** LLM tags of game subsystems, see stat LLMFULL */
+enum class EShooterLLMTag : LLM_TAG_TYPE
+{
+	Weapons = (LLM_TAG_TYPE)ELLMTag::ProjectTagStart,
+	Characters,
+	Bots,
+	UI,
+	Effects,
+};
+
+/** tracks allocations of scope under LLM tag of subsystem */
+#define SHOOTER_LLM_SCOPE(Tag) LLM_SCOPE((ELLMTag)EShooterLLMTag::Tag)
+#else
+#define SHOOTER_LLM_SCOPE(Tag)
+#endif
+
 /** when you modify this, please note that this information can be saved with instances
  * also DefaultEngine.ini [/Script/Engine.CollisionProfile] should match with this list **/
 #define COLLISION_WEAPON		ECC_GameTraceChannel1
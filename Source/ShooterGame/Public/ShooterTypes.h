@@ -159,4 +159,131 @@ public:
 	FDamageEvent& GetDamageEvent();
 	void SetDamageEvent(const FDamageEvent& DamageEvent);
 	void EnsureReplication();
-};
\ No newline at end of file
+};
+
+/** flags of kill feed entries */
+namespace EShooterKillFeedFlags
+{
+	enum Type
+	{
+		/** victim killed itself */
+		Suicide = 1 << 0,
+	};
+}
+
+/** single kill sent to clients in batch, see AShooterGameState::MulticastKillFeed */
+USTRUCT()
+struct FShooterKillFeedEntry
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** PlayerId of killer, INDEX_NONE when unknown */
+	int32 KillerId;
+
+	/** PlayerId of victim */
+	int32 VictimId;
+
+	/** index to AShooterGameState::KillFeedDamageTypes, INDEX_NONE when not listed */
+	int32 DamageTypeIndex;
+
+	/** EShooterKillFeedFlags */
+	uint8 Flags;
+
+	FShooterKillFeedEntry()
+		: KillerId(INDEX_NONE)
+		, VictimId(INDEX_NONE)
+		, DamageTypeIndex(INDEX_NONE)
+		, Flags(0)
+	{
+	}
+
+	/** ids and index are sent packed, shifted by one so INDEX_NONE fits */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		uint32 PackedKillerId = KillerId + 1;
+		uint32 PackedVictimId = VictimId + 1;
+		uint32 PackedDamageTypeIndex = DamageTypeIndex + 1;
+		Ar.SerializeIntPacked(PackedKillerId);
+		Ar.SerializeIntPacked(PackedVictimId);
+		Ar.SerializeIntPacked(PackedDamageTypeIndex);
+		Ar << Flags;
+
+		if (Ar.IsLoading())
+		{
+			KillerId = (int32)PackedKillerId - 1;
+			VictimId = (int32)PackedVictimId - 1;
+			DamageTypeIndex = (int32)PackedDamageTypeIndex - 1;
+		}
+
+		bOutSuccess = true;
+		return true;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FShooterKillFeedEntry> : public TStructOpsTypeTraitsBase2<FShooterKillFeedEntry>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+/** chat channels */
+namespace EShooterChatChannel
+{
+	enum Type
+	{
+		/** everyone */
+		All,
+		/** players of sender's team, everyone in games without teams */
+		Team,
+	};
+}
+
+/** single chat message, see FShooterChatService */
+USTRUCT()
+struct FShooterChatLine
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** index to names of recipient, see FShooterChatBatch::NewNames */
+	UPROPERTY()
+	int32 NameIndex;
+
+	/** EShooterChatChannel */
+	UPROPERTY()
+	uint8 Channel;
+
+	UPROPERTY()
+	FString Text;
+
+	FShooterChatLine()
+		: NameIndex(INDEX_NONE)
+		, Channel(EShooterChatChannel::All)
+	{
+	}
+};
+
+/** chat messages of one net frame for single recipient */
+USTRUCT()
+struct FShooterChatBatch
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** sender names not sent to recipient before, appended to its name table */
+	UPROPERTY()
+	TArray<FString> NewNames;
+
+	UPROPERTY()
+	TArray<FShooterChatLine> Lines;
+
+	/** recipient should clear name table before appending NewNames */
+	UPROPERTY()
+	bool bResetNames;
+
+	FShooterChatBatch()
+		: bResetNames(false)
+	{
+	}
+};
@@ -0,0 +1,160 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/GCObject.h"
+
+class UAudioComponent;
+class USoundBase;
+
+/** categories of gameplay sounds, each with own voice limit and priority weight */
+namespace EShooterSoundCategory
+{
+	enum Type
+	{
+		Weapon,
+		Impact,
+		Movement,
+		/** low health, targeting, death and other feedback of player */
+		Player,
+		MAX,
+	};
+}
+
+/**
+ * Plays gameplay sounds on pooled audio components under a global voice budget. Every sound gets priority from
+ * weight of its category and distance to closest local listener; once category or global limit is reached, new sound
+ * takes the voice of least important playing one or isn't played at all. Sounds out of their attenuation range are
+ * never started. Owned by the game state, does nothing on dedicated servers.
+ */
+class FShooterAudioManager : public FGCObject
+{
+public:
+
+	struct FCategoryStats
+	{
+		/** sounds started */
+		int32 NumPlayed;
+
+		/** sounds stopped to free voice for more important ones */
+		int32 NumStolen;
+
+		/** sounds not started, out of range or over budget */
+		int32 NumDropped;
+	};
+
+	FShooterAudioManager();
+
+	// Begin FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FShooterAudioManager"); }
+	// End FGCObject interface
+
+	/** sets world to play sounds in */
+	void Initialize(UWorld* InWorld);
+
+	/** get manager of world */
+	static FShooterAudioManager* Get(const UObject* WorldContextObject);
+
+	/**
+	 * play sound attached to component, or at location when AttachTo is NULL. Returns NULL when sound didn't get a voice.
+	 * Retained sounds keep their component until ReleaseSound, others return it to pool once finished.
+	 */
+	UAudioComponent* PlaySound(EShooterSoundCategory::Type Category, USoundBase* Sound, USceneComponent* AttachTo, const FVector& Location, bool bRetain);
+
+	/** stops sound and returns its component to pool, returns false if component isn't from pool */
+	bool ReleaseSound(UAudioComponent* AudioComponent, float FadeOutTime);
+
+	/** returns finished components to pool and updates priorities of playing sounds */
+	void Tick();
+
+	/** get number of sounds playing in category */
+	int32 GetNumActiveVoices(EShooterSoundCategory::Type Category) const { return NumActiveVoices[Category]; }
+
+	/** get number of audio components in pool, including ones in use */
+	int32 GetNumComponents() const { return Voices.Num(); }
+
+	/** get counters of category */
+	const FCategoryStats& GetStats(EShooterSoundCategory::Type Category) const { return Stats[Category]; }
+
+	/** clears counters */
+	void ResetStats();
+
+	/** get voice limit of category */
+	static int32 GetMaxVoices(EShooterSoundCategory::Type Category);
+
+	/** get display name of category */
+	static const TCHAR* GetCategoryName(EShooterSoundCategory::Type Category);
+
+	/** play sound attached to component through audio manager of its world, without manager it's played as before */
+	static UAudioComponent* SpawnSoundAttached(EShooterSoundCategory::Type Category, USoundBase* Sound, USceneComponent* AttachTo, bool bRetain = false);
+
+	/** play one shot sound at location through audio manager of world, without manager it's played as before */
+	static void PlaySoundAtLocation(const UObject* WorldContextObject, EShooterSoundCategory::Type Category, USoundBase* Sound, const FVector& Location);
+
+	/** stops sound returned by SpawnSoundAttached and clears reference */
+	static void StopSound(UAudioComponent*& AudioComponent, float FadeOutTime = 0.0f);
+
+private:
+
+	struct FVoice
+	{
+		UAudioComponent* Component;
+
+		/** component sound is attached to, sound stops when it's gone */
+		TWeakObjectPtr<USceneComponent> AttachedTo;
+
+		EShooterSoundCategory::Type Category;
+
+		/** importance of sound, updated every tick while playing */
+		float Priority;
+
+		/** component is playing or reserved */
+		bool bInUse;
+
+		/** component is kept for caller until released */
+		bool bRetained;
+
+		/** sound follows AttachedTo */
+		bool bAttached;
+	};
+
+	/** gathers listener locations, at most once per frame */
+	void UpdateListeners();
+
+	/** get priority of sound in category played at location */
+	float GetPriority(EShooterSoundCategory::Type Category, const FVector& Location) const;
+
+	/** get squared distance from closest listener */
+	float GetListenerDistanceSq(const FVector& Location) const;
+
+	/** find playing voice with lowest priority below Priority, in category or in all voices when category is MAX */
+	int32 FindVoiceToSteal(EShooterSoundCategory::Type Category, float Priority) const;
+
+	/** stop voice to reuse it */
+	void StealVoice(int32 VoiceIdx);
+
+	/** get free voice, creating component when needed */
+	int32 AcquireVoice();
+
+	/** find voice of component */
+	int32 FindVoice(const UAudioComponent* AudioComponent) const;
+
+	/** world to play sounds in */
+	TWeakObjectPtr<UWorld> World;
+
+	/** all pooled components */
+	TArray<FVoice> Voices;
+
+	/** locations of local listeners */
+	TArray<FVector> ListenerLocations;
+
+	/** frame of last listener update */
+	uint64 LastListenerFrame;
+
+	/** sounds playing, by category */
+	int32 NumActiveVoices[EShooterSoundCategory::MAX];
+
+	/** counters, by category */
+	FCategoryStats Stats[EShooterSoundCategory::MAX];
+};
@@ -4,23 +4,74 @@
 
 #include "GameFramework/Actor.h"
 #include "ShooterWeapon_Projectile.h"
+#include "ShooterProjectilePool.h"
 #include "ShooterProjectile.generated.h"
 
 class UProjectileMovementComponent;
 class USphereComponent;
 
+/** spawn parameters of projectile, clients simulate trajectory from them */
+USTRUCT()
+struct FShooterProjectileLaunchInfo
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** location projectile was fired from */
+	UPROPERTY()
+	FVector_NetQuantize Origin;
+
+	/** direction of initial velocity */
+	UPROPERTY()
+	FVector_NetQuantizeNormal Direction;
+
+	/** server world time of launch */
+	UPROPERTY()
+	float LaunchTime;
+
+	/** shot of firing client this projectile confirms, 0 if not predicted */
+	UPROPERTY()
+	uint8 ShotId;
+
+	FShooterProjectileLaunchInfo()
+		: Origin(ForceInitToZero)
+		, Direction(ForceInitToZero)
+		, LaunchTime(0.0f)
+		, ShotId(0)
+	{}
+};
+
 // 
 UCLASS(Abstract, Blueprintable)
-class AShooterProjectile : public AActor
+class AShooterProjectile : public AActor, public IShooterPoolableActor
 {
 	GENERATED_UCLASS_BODY()
 
 	/** initial setup */
 	virtual void PostInitializeComponents() override;
 
+	/** start simulation */
+	virtual void BeginPlay() override;
+
+	/** stop simulation */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** return to pool instead of destroying */
+	virtual void LifeSpanExpired() override;
+
+	// Begin IShooterPoolableActor interface
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
+	// End IShooterPoolableActor interface
+
 	/** setup velocity */
 	void InitVelocity(FVector& ShootDirection);
 
+	/** setup shot matching, bInPredicted for local copy spawned by firing client */
+	void SetShotId(uint8 InShotId, bool bInPredicted);
+
+	/** get shot of firing client */
+	uint8 GetShotId() const { return LaunchInfo.ShotId; }
+
 	/** handle hit */
 	UFUNCTION()
 	void OnImpact(const FHitResult& HitResult);
@@ -48,23 +99,57 @@ protected:
 	/** projectile data */
 	struct FProjectileWeaponData WeaponConfig;
 
+	/** spawn parameters, changed only when fired */
+	UPROPERTY(Transient, ReplicatedUsing=OnRep_LaunchInfo)
+	FShooterProjectileLaunchInfo LaunchInfo;
+
+	/** is it local copy spawned by firing client ahead of server? */
+	bool bPredicted;
+
 	/** did it explode? */
 	UPROPERTY(Transient, ReplicatedUsing=OnRep_Exploded)
 	bool bExploded;
 
+	/** where it exploded, replicated with bExploded */
+	UPROPERTY(Transient, Replicated)
+	FVector_NetQuantize ImpactLocation;
+
+	/** surface normal at impact, replicated with bExploded */
+	UPROPERTY(Transient, Replicated)
+	FVector_NetQuantizeNormal ImpactNormal;
+
+	/** [client] projectile was fired again after reuse from pool */
+	UFUNCTION()
+	void OnRep_LaunchInfo();
+
 	/** [client] explosion happened */
 	UFUNCTION()
 	void OnRep_Exploded();
 
+	/** read config of weapon that fired me */
+	void InitFromOwner();
+
+	/** restart effects stopped by explosion */
+	void RestartEffects();
+
+	/**
+	 * start moving from launch info, by projectile manager or movement component
+	 * @param ForwardTime	seconds to catch up right away
+	 */
+	void StartSimulation(float ForwardTime);
+
+	/** stop moving */
+	void StopSimulation();
+
+	/** [client] replace predicted projectile of same shot, blending from its location */
+	void ReplacePrediction(float ForwardTime);
+
 	/** trigger explosion */
 	void Explode(const FHitResult& Impact);
 
 	/** shutdown projectile and prepare for destruction */
 	void DisableAndDestroy();
 
-	/** update velocity on client */
-	virtual void PostNetReceiveVelocity(const FVector& NewVelocity) override;
-
 protected:
 	/** Returns MovementComp subobject **/
 	FORCEINLINE UProjectileMovementComponent* GetMovementComp() const { return MovementComp; }
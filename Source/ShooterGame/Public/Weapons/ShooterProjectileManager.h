@@ -0,0 +1,84 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+class AShooterProjectile;
+
+/**
+ * Moves all projectiles of the world in a single tick, instead of a movement component per projectile.
+ * State is kept as struct of arrays, sweeps are run back to back and projectiles are only notified on hit.
+ * Runs on server and clients alike: clients simulate from replicated launch parameters. Owned by the game state.
+ */
+class FShooterProjectileManager
+{
+public:
+
+	FShooterProjectileManager();
+
+	/** sets world for sweeps */
+	void Initialize(UWorld* InWorld);
+
+	/** get manager of world */
+	static FShooterProjectileManager* Get(const UObject* WorldContextObject);
+
+	/** should new projectiles use batched simulation? */
+	static bool IsEnabled();
+
+	/**
+	 * start simulating projectile
+	 * @param ForwardTime	seconds to simulate right away, to catch up with server on clients
+	 */
+	void AddProjectile(AShooterProjectile* Projectile, const FVector& Location, const FVector& Velocity, float MaxSpeed, float GravityScale, float ForwardTime);
+
+	/** stop simulating projectile */
+	void RemoveProjectile(AShooterProjectile* Projectile);
+
+	/** display projectile shifted by Offset, fading out over BlendTime */
+	void SetVisualOffset(AShooterProjectile* Projectile, const FVector& Offset, float BlendTime);
+
+	/** moves projectiles and dispatches hits */
+	void Tick(float DeltaSeconds);
+
+	/** get number of simulated projectiles */
+	int32 GetNumProjectiles() const { return Projectiles.Num(); }
+
+private:
+
+	/** removes element, last one takes its place */
+	void RemoveAtSwap(int32 Index);
+
+	/** world used for sweeps */
+	TWeakObjectPtr<UWorld> World;
+
+	/** simulated projectiles, other arrays are indexed the same way */
+	TArray<TWeakObjectPtr<AShooterProjectile>> Projectiles;
+
+	TArray<FVector> Locations;
+
+	TArray<FVector> Velocities;
+
+	TArray<float> MaxSpeeds;
+
+	TArray<float> GravityScales;
+
+	/** time to simulate in addition to next frame */
+	TArray<float> ForwardTimes;
+
+	/** radius of collision sphere */
+	TArray<float> Radii;
+
+	/** object type of collision sphere */
+	TArray<TEnumAsByte<ECollisionChannel>> Channels;
+
+	/** responses of collision sphere */
+	TArray<FCollisionResponseContainer> Responses;
+
+	/** actor which fired projectile, never hit */
+	TArray<TWeakObjectPtr<AActor>> Instigators;
+
+	/** displayed location minus simulated one, at start of blend */
+	TArray<FVector> VisualOffsets;
+
+	/** remaining and total time of visual offset blend */
+	TArray<FVector2D> VisualBlendTimes;
+};
@@ -0,0 +1,130 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/Interface.h"
+#include "ShooterProjectilePool.generated.h"
+
+UINTERFACE(meta=(CannotImplementInterfaceInBlueprint))
+class UShooterPoolableActor : public UInterface
+{
+	GENERATED_UINTERFACE_BODY()
+};
+
+/** actor which can be reused by projectile pool instead of being destroyed */
+class IShooterPoolableActor
+{
+	GENERATED_IINTERFACE_BODY()
+
+	/** [server] actor was taken from pool and set up by spawner, start simulating again */
+	virtual void OnAcquiredFromPool() {}
+
+	/** [server] actor goes back to pool, stop simulating and clear state */
+	virtual void OnReleasedToPool() {}
+};
+
+/**
+ * Keeps inactive projectiles and grenades for reuse, so sustained fights don't allocate and garbage collect
+ * actors and components for every shot. Released actors are hidden and net dormant, clients keep their copy
+ * and the actor channel is reopened on reuse. Server only, owned by the game mode.
+ */
+class FShooterProjectilePool
+{
+public:
+
+	FShooterProjectilePool();
+	~FShooterProjectilePool();
+
+	/** sets world to spawn in and starts measuring garbage collection */
+	void Initialize(UWorld* InWorld);
+
+	/** get pool of world, NULL on clients */
+	static FShooterProjectilePool* Get(const UObject* WorldContextObject);
+
+	/** takes actor from pool or spawns new one. InitFunc is called before it starts simulating */
+	template<typename T>
+	T* SpawnActor(TSubclassOf<T> Class, const FTransform& Transform, AActor* Owner, APawn* Instigator, TFunctionRef<void(T*)> InitFunc)
+	{
+		return Cast<T>(SpawnActor(Class.Get(), Transform, Owner, Instigator, [&InitFunc](AActor* Actor) { InitFunc(CastChecked<T>(Actor)); }));
+	}
+
+	AActor* SpawnActor(UClass* Class, const FTransform& Transform, AActor* Owner, APawn* Instigator, TFunctionRef<void(AActor*)> InitFunc);
+
+	/** returns actor to pool. When false is returned, it wasn't pooled and should be destroyed */
+	bool ReleaseActor(AActor* Actor);
+
+	/** is actor waiting in pool? */
+	bool IsInPool(const AActor* Actor) const;
+
+	/** makes sure there are at least Count instances of class */
+	void Prewarm(UClass* Class, int32 Count = -1);
+
+	/** hit rate and savings per class */
+	void GetStats(TArray<FString>& OutLines) const;
+
+	/** clears counters */
+	void ResetStats();
+
+private:
+
+	struct FClassPool
+	{
+		/** inactive actors */
+		TArray<TWeakObjectPtr<AActor>> FreeActors;
+
+		/** actors of class alive, pooled or in use */
+		int32 NumInstances;
+
+		/** actors created, including prewarm */
+		int32 NumSpawned;
+
+		/** spawn requests served from pool */
+		int32 NumHits;
+
+		/** spawn requests which had to create actor */
+		int32 NumMisses;
+
+		/** UObjects making up single actor, counted on first spawn */
+		int32 NumObjectsPerActor;
+
+		/** total time spent in creating actors (ms) */
+		double SpawnTimeMs;
+
+		FClassPool()
+			: NumInstances(0)
+			, NumSpawned(0)
+			, NumHits(0)
+			, NumMisses(0)
+			, NumObjectsPerActor(0)
+			, SpawnTimeMs(0.0)
+		{
+		}
+	};
+
+	/** spawns new actor, InitFunc is called before it finishes spawning */
+	AActor* CreateActor(FClassPool& ClassPool, UClass* Class, const FTransform& Transform, AActor* Owner, APawn* Instigator, TFunctionRef<void(AActor*)> InitFunc);
+
+	/** hides actor and puts it to sleep */
+	void DeactivateActor(AActor* Actor);
+
+	void OnPreGarbageCollect();
+	void OnPostGarbageCollect();
+
+	/** world used for spawning */
+	TWeakObjectPtr<UWorld> World;
+
+	/** pools by actor class */
+	TMap<TWeakObjectPtr<UClass>, FClassPool> ClassPools;
+
+	/** garbage collections since stats reset */
+	int32 NumGarbageCollections;
+
+	/** time spent in garbage collection since stats reset (ms) */
+	double GarbageCollectionTimeMs;
+
+	/** start of running garbage collection */
+	double GarbageCollectionStartTime;
+
+	FDelegateHandle PreGarbageCollectHandle;
+	FDelegateHandle PostGarbageCollectHandle;
+};
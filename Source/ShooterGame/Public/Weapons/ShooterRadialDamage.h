@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "WorldCollision.h"
+#include "GameFramework/DamageType.h" // for UDamageType::StaticClass()
+
+class UCurveFloat;
+
+/** single explosion handled by radial damage service */
+struct FShooterRadialDamageParams
+{
+	/** center of explosion */
+	FVector Origin;
+
+	/** max distance of damaged actors */
+	float Radius;
+
+	/** damage at origin, linear falloff to 0 at Radius. Ignored when DamageCurve is set */
+	float BaseDamage;
+
+	/** damage by distance, X = distance, Y = damage */
+	TWeakObjectPtr<const UCurveFloat> DamageCurve;
+
+	/** type of damage */
+	TSubclassOf<UDamageType> DamageTypeClass;
+
+	/** actor which exploded, never damaged */
+	TWeakObjectPtr<AActor> DamageCauser;
+
+	/** controller responsible for damage */
+	TWeakObjectPtr<AController> EventInstigator;
+
+	/** geometry blocking this channel protects actors, pawns never do */
+	TEnumAsByte<ECollisionChannel> OcclusionChannel;
+
+	FShooterRadialDamageParams()
+		: Origin(ForceInitToZero)
+		, Radius(0.0f)
+		, BaseDamage(0.0f)
+		, DamageTypeClass(UDamageType::StaticClass())
+		, OcclusionChannel(COLLISION_BLAST)
+	{
+	}
+};
+
+/**
+ * Radial damage shared by grenades and projectiles. Explosions are queued and processed by the game mode tick:
+ * explosions close to each other in the same frame share one spatial query and one occlusion trace per actor,
+ * traces are issued as async batch and damage is applied once their results come back, on the next frame.
+ */
+class FShooterRadialDamageService
+{
+public:
+
+	FShooterRadialDamageService();
+
+	/** sets world used for queries */
+	void Initialize(UWorld* InWorld);
+
+	/** queue explosion, damage is applied within next frames */
+	void ApplyRadialDamage(const FShooterRadialDamageParams& Params);
+
+	/** finishes batches with completed traces and starts new ones */
+	void Tick();
+
+	/** get damage of explosion at distance from origin */
+	static float GetDamageAtDistance(const FShooterRadialDamageParams& Params, float Distance);
+
+	/** runs spatial query and traces of single explosion synchronously, without applying damage. Returns average time (ms) */
+	double MeasureExplosion(const FShooterRadialDamageParams& Params, int32 Iterations, int32& OutNumCandidates, int32& OutNumVisible);
+
+private:
+
+	struct FTarget
+	{
+		TWeakObjectPtr<AActor> Actor;
+
+		/** point traced to */
+		FVector Location;
+
+		/** primitive overlapped by spatial query */
+		TWeakObjectPtr<UPrimitiveComponent> Component;
+
+		FTraceHandle TraceHandle;
+
+		bool bVisible;
+	};
+
+	struct FBatch
+	{
+		/** origin of spatial query and traces */
+		FVector Origin;
+
+		/** radius of spatial query */
+		float Radius;
+
+		ECollisionChannel OcclusionChannel;
+
+		TArray<FShooterRadialDamageParams> Explosions;
+
+		TArray<FTarget> Targets;
+	};
+
+	/** gathers targets and starts traces */
+	void StartBatch(FBatch& Batch, bool bAsync);
+
+	/** collects trace results, returns false when some are still pending */
+	bool UpdateBatchTraces(FBatch& Batch);
+
+	/** applies damage of all explosions in batch */
+	void ApplyBatchDamage(const FBatch& Batch);
+
+	/** checks if trace reached target before world geometry */
+	static bool IsTargetVisible(const TArray<FHitResult>& Hits, const AActor* Target);
+
+	/** get query params ignoring causers of batch */
+	FCollisionQueryParams GetTraceParams(const FBatch& Batch) const;
+
+	/** world used for queries */
+	TWeakObjectPtr<UWorld> World;
+
+	/** explosions queued this frame */
+	TArray<FShooterRadialDamageParams> QueuedExplosions;
+
+	/** batches waiting for traces */
+	TArray<FBatch> PendingBatches;
+};
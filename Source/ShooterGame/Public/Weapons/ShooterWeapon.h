@@ -25,6 +25,21 @@ namespace EWeaponState
 	};
 }
 
+/** cosmetic fidelity of remote weapon fire */
+namespace EWeaponFireLOD
+{
+	enum Type
+	{
+		/** everything: muzzle, trails, anims, attached sounds */
+		Full,
+		/** muzzle and unattached sounds only */
+		Reduced,
+		/** unattached sounds only */
+		Minimal,
+		MAX,
+	};
+}
+
 USTRUCT()
 struct FWeaponData
 {
@@ -460,6 +475,14 @@ protected:
 	/** Called in network play to stop cosmetic fx (e.g. for a looping shot). */
 	virtual void StopSimulatingWeaponFire();
 
+	/** get fidelity of fire effects by distance and visibility to local viewers */
+	EWeaponFireLOD::Type GetFireLOD() const;
+
+public:
+	/** simulated shots per fire LOD since last reset */
+	static int32 FireLODCounters[EWeaponFireLOD::MAX];
+
+protected:
 
 	//////////////////////////////////////////////////////////////////////////
 	// Weapon usage
@@ -503,8 +526,8 @@ protected:
 	//////////////////////////////////////////////////////////////////////////
 	// Weapon usage helpers
 
-	/** play weapon sounds */
-	UAudioComponent* PlayWeaponSound(USoundCue* Sound);
+	/** play weapon sounds, retained sound must be stopped through FShooterAudioManager::StopSound */
+	UAudioComponent* PlayWeaponSound(USoundCue* Sound, bool bRetain = false);
 
 	/** play weapon animations */
 	float PlayWeaponAnimation(const FWeaponAnim& Animation);
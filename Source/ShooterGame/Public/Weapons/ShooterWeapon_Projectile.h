@@ -51,6 +51,12 @@ class AShooterWeapon_Projectile : public AShooterWeapon
 	/** apply config on projectile */
 	void ApplyWeaponConfig(FProjectileWeaponData& Data);
 
+	/** [server] prewarm projectile pool */
+	virtual void PostInitializeComponents() override;
+
+	/** [local] take predicted projectile of shot, NULL if it's gone already */
+	class AShooterProjectile* TakePredictedProjectile(uint8 ShotId);
+
 protected:
 
 	virtual EAmmoType GetAmmoType() const override
@@ -68,7 +74,20 @@ protected:
 	/** [local] weapon specific fire implementation */
 	virtual void FireWeapon() override;
 
-	/** spawn projectile on server */
+	/** spawn projectile on server, ShotId matches it with prediction of firing client (0 = not predicted) */
 	UFUNCTION(reliable, server, WithValidation)
-	void ServerFireProjectile(FVector Origin, FVector_NetQuantizeNormal ShootDir);
+	void ServerFireProjectile(FVector Origin, FVector_NetQuantizeNormal ShootDir, uint8 ShotId);
+
+	/** [client] server didn't spawn projectile of shot */
+	UFUNCTION(unreliable, client)
+	void ClientRejectProjectile(uint8 ShotId);
+
+	/** spawn projectile, from pool when available */
+	class AShooterProjectile* SpawnProjectile(const FVector& Origin, const FVector& ShootDir, uint8 ShotId, bool bPredicted);
+
+	/** [local] projectiles spawned ahead of server, waiting for their replicated counterpart */
+	TArray<TWeakObjectPtr<class AShooterProjectile>> PredictedProjectiles;
+
+	/** [local] id of last predicted shot */
+	uint8 LastShotId;
 };
@@ -50,7 +50,8 @@ public class ShooterGame : ModuleRules
 				"PakFile",
 				"RHI",
 				"PhysicsCore",
-                "Niagara"
+                "Niagara",
+				"NetCore"
 			}
 		);
 
@@ -11,6 +11,8 @@ public class ShooterServerTarget : TargetRules
 		Type = TargetType.Server;
 		bUsesSteam = true;
 
+		bWithPushModel = true;
+
 		ExtraModuleNames.Add("ShooterGame");
 	}
 }